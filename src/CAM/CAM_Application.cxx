@@ -29,6 +29,7 @@
 #include <SUIT_Desktop.h>
 #include <SUIT_Session.h>
 #include <SUIT_MessageBox.h>
+#include <SUIT_Profiler.h>
 #include <SUIT_ResourceMgr.h>
 
 #include <KernelBasis.hxx>
@@ -140,11 +141,14 @@ CAM_Application::~CAM_Application()
 void CAM_Application::start()
 {
   // check modules
-  for ( ModuleInfoList::iterator it = myInfoList.begin();
-        it != myInfoList.end(); ++it )
   {
-    if ( (*it).status == stUnknown )
-      (*it).status = checkModule( (*it).title ) ? stReady : stInaccessible;
+    SUIT_Profiler::Scope aScope( "check modules" );
+    for ( ModuleInfoList::iterator it = myInfoList.begin();
+          it != myInfoList.end(); ++it )
+    {
+      if ( (*it).status == stUnknown )
+        (*it).status = checkModule( (*it).title ) ? stReady : stInaccessible;
+    }
   }
 
   // auto-load modules
@@ -241,7 +245,10 @@ void CAM_Application::addModule( CAM_Module* mod )
   if ( !mod || myModules.contains( mod ) )
     return;
 
-  mod->initialize( this );
+  {
+    SUIT_Profiler::Scope aScope( QString( "initialize module %1" ).arg( mod->moduleName() ) );
+    mod->initialize( this );
+  }
 
   QMap<CAM_Module*, int> map;
 
@@ -322,6 +329,8 @@ CAM_Module* CAM_Application::loadModule( const QString& modName, const bool show
     return 0;
   }
 
+  SUIT_Profiler::Scope aScope( QString( "load module %1" ).arg( modName ) );
+
   QString err;
   GET_MODULE_FUNC crtInst = 0;
   GET_VERSION_FUNC getVersion = 0;
@@ -468,6 +477,9 @@ bool CAM_Application::activateModule( CAM_Module* mod )
   if ( myModule == mod )
     return true;
 
+  SUIT_Profiler::Scope aScope( mod ? QString( "activate module %1" ).arg( mod->moduleName() ) :
+                                     QString( "deactivate module" ) );
+
   if ( myModule )
   {
     if ( myModule->deactivateModule( activeStudy() ) )
@@ -521,9 +533,8 @@ bool CAM_Application::activateModule( CAM_Module* mod )
 bool CAM_Application::activateOperation( const QString& modName,
                                          const int actionId )
 {
-  CAM_Module* mod = loadModule(modName, false);
+  CAM_Module* mod = operationModule(modName);
   if (mod) {
-    addModule(mod);
     return mod->activateOperation(actionId);
   }
   return false;
@@ -539,9 +550,8 @@ bool CAM_Application::activateOperation( const QString& modName,
 bool CAM_Application::activateOperation( const QString& modName,
                                          const QString& actionId )
 {
-  CAM_Module* mod = loadModule(modName, false);
+  CAM_Module* mod = operationModule(modName);
   if (mod) {
-    addModule(mod);
     return mod->activateOperation(actionId);
   }
   return false;
@@ -560,14 +570,35 @@ bool CAM_Application::activateOperation( const QString& modName,
                                          const QString& actionId,
                                          const QString& pluginName )
 {
-  CAM_Module* mod = loadModule(modName, false);
+  CAM_Module* mod = operationModule(modName);
   if (mod) {
-    addModule(mod);
     return mod->activateOperation(actionId, pluginName);
   }
   return false;
 }
 
+/*!
+  \brief Get module to run operation of.
+
+  Module library is loaded only if the module has not been loaded yet,
+  otherwise the loaded module is used.
+
+  \param modName module name or title
+  \return module object pointer or 0 if module could not be loaded
+*/
+CAM_Module* CAM_Application::operationModule( const QString& modName )
+{
+  CAM_Module* mod = module( modName );
+  if ( !mod && !moduleTitle( modName ).isEmpty() )
+    mod = module( moduleTitle( modName ) );
+  if ( !mod )
+  {
+    mod = loadModule( modName, false );
+    addModule( mod );
+  }
+  return mod;
+}
+
 /*!
   \brief Create new study.
   \return study object pointer
@@ -783,6 +814,8 @@ void CAM_Application::readModuleList()
   if ( !myInfoList.isEmpty() )
     return;
 
+  SUIT_Profiler::Scope aScope( "read modules list" );
+
   // we cannot use own resourceMgr() as this method can be called from constructor
   SUIT_ResourceMgr* resMgr = SUIT_Session::session()->resourceMgr();
 
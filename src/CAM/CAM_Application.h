@@ -115,6 +115,8 @@ protected:
   void                removeModuleInfo( const QString& );
   void                showAllModuleInfo();
 
+  CAM_Module*         operationModule( const QString& );
+
 private:
   enum { stInvalid = -1, stUnknown = 0, stNoGui, stInaccessible, stReady };
   struct ModuleInfo
@@ -0,0 +1,87 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "CAM_Module.h"
+#include "CAM_Application.h"
+
+#include <SUIT_Desktop.h>
+
+#include <QAction>
+#include <QIcon>
+
+#ifdef WIN32
+#  define DUMMYMODULE_EXPORT __declspec( dllexport )
+#else
+#  define DUMMYMODULE_EXPORT
+#endif
+
+/*
+  Class       : DummyModule
+  Description : Module with a menu and a toolbar of many actions, without data
+*/
+class DummyModule : public CAM_Module
+{
+public:
+  enum { NbActions = 50 };
+
+  virtual void initialize( CAM_Application* theApp )
+  {
+    CAM_Module::initialize( theApp );
+
+    int aMenu = createMenu( moduleName(), -1, -1, 10 );
+    int aTool = createTool( moduleName(), name() );
+    for ( int i = 0; i < NbActions; i++ ) {
+      QAction* anAction = createAction( -1, QString( "Action %1" ).arg( i ), QIcon(),
+                                        QString( "Action %1" ).arg( i ), QString(), 0,
+                                        theApp->desktop() );
+      createMenu( anAction, aMenu );
+      createTool( anAction, aTool );
+    }
+    setMenuShown( false );
+    setToolShown( false );
+  }
+
+  virtual bool activateModule( SUIT_Study* theStudy )
+  {
+    bool isOk = CAM_Module::activateModule( theStudy );
+    setMenuShown( true );
+    setToolShown( true );
+    return isOk;
+  }
+
+  virtual bool deactivateModule( SUIT_Study* theStudy )
+  {
+    setMenuShown( false );
+    setToolShown( false );
+    return CAM_Module::deactivateModule( theStudy );
+  }
+};
+
+extern "C"
+{
+  DUMMYMODULE_EXPORT CAM_Module* createModule()
+  {
+    return new DummyModule();
+  }
+
+  DUMMYMODULE_EXPORT char* getModuleVersion()
+  {
+    return (char*)"1.0";
+  }
+}
@@ -0,0 +1,235 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "CAM_Application.h"
+#include "CAM_Module.h"
+
+#include <SUIT_Profiler.h>
+#include <SUIT_Session.h>
+
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+
+namespace
+{
+  const int NbModules = 20;
+
+  // Title of the dummy module
+  QString ModuleTitle( int theIndex )
+  {
+    return QString( "Dummy%1" ).arg( theIndex );
+  }
+
+  // Writes resources of CAM application: list of the dummy modules, all
+  // of them are loaded from the same library
+  bool WriteResources( const QString& theDir )
+  {
+    QStringList aNames;
+    for ( int i = 0; i < NbModules; i++ )
+      aNames << ModuleTitle( i ).toUpper();
+
+    QFile aFile( QDir( theDir ).filePath( "CAM.xml" ) );
+    if ( !aFile.open( QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text ) )
+      return false;
+
+    QTextStream aStream( &aFile );
+    aStream << "<document>\n"
+            << "  <section name=\"launch\">\n"
+            << "    <parameter name=\"modules\" value=\"" << aNames.join( "," ) << "\"/>\n"
+            << "  </section>\n";
+    for ( int i = 0; i < NbModules; i++ )
+      aStream << "  <section name=\"" << aNames[i] << "\">\n"
+              << "    <parameter name=\"name\" value=\"" << ModuleTitle( i ) << "\"/>\n"
+              << "    <parameter name=\"library\" value=\"DummyModule\"/>\n"
+              << "  </section>\n";
+    aStream << "</document>\n";
+    aStream.flush();
+    return aFile.error() == QFile::NoError;
+  }
+
+  // Reads names of the events from the trace file
+  QStringList TraceEvents( const QString& theFileName )
+  {
+    QStringList aNames;
+    QFile aFile( theFileName );
+    if ( !aFile.open( QIODevice::ReadOnly ) )
+      return aNames;
+    // trace is a JSON array which may be left unterminated
+    QByteArray aData = aFile.readAll().trimmed();
+    if ( !aData.endsWith( "]" ) )
+      aData += "]";
+    QJsonArray anEvents = QJsonDocument::fromJson( aData ).array();
+    for ( int i = 0; i < anEvents.count(); i++ )
+      aNames << anEvents[i].toObject().value( "name" ).toString();
+    return aNames;
+  }
+}
+
+/*!
+  \class CAMTest: test suit
+*/
+class CAMTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( CAMTest );
+  CPPUNIT_TEST( testStartup );
+  CPPUNIT_TEST( testProfilerLimit );
+  CPPUNIT_TEST( testProfilerUnwritable );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+  void testStartup();
+  void testProfilerLimit();
+  void testProfilerUnwritable();
+
+private:
+  QString myTraceFile;
+};
+
+/*!
+  Set up each test case
+*/
+void CAMTest::setUp()
+{
+  GuiTest_Fixture::setUp();
+
+  if ( !SUIT_Session::session() ) {
+    QString aResDir = QDir::temp().filePath( "TestCAM_resources" );
+    CPPUNIT_ASSERT( QDir().mkpath( aResDir ) && WriteResources( aResDir ) );
+    qputenv( "CAMResources", aResDir.toUtf8() );
+    new SUIT_Session();
+  }
+
+  myTraceFile = QDir::temp().filePath( "TestCAM_trace.json" );
+  SUIT_Profiler::setFileName( myTraceFile );
+}
+
+/*!
+  Clean-up each test case
+*/
+void CAMTest::tearDown()
+{
+  SUIT_Profiler::setFileName( QString() );
+  QFile::remove( myTraceFile );
+  GuiTest_Fixture::tearDown();
+}
+
+/*!
+  Measure time of start of the application with dummy modules and their
+  activation: first (cold) start loads the libraries, second (warm) one
+  reuses them. Check that the startup timeline is written
+*/
+void CAMTest::testStartup()
+{
+  GuiTest_Timer aTimer( QString( "CAM_Application with %1 modules" ).arg( NbModules ) );
+
+  for ( int aRun = 0; aRun < 2; aRun++ ) {
+    const QString aMode = aRun ? "warm" : "cold";
+    aTimer.restart();
+
+    // all modules are loaded on start
+    CAM_Application* anApp = dynamic_cast<CAM_Application*>( SUIT_Session::session()->startApplication( "CAM" ) );
+    CPPUNIT_ASSERT( anApp );
+    anApp->createEmptyStudy();
+    aTimer.step( aMode + " start" );
+    CPPUNIT_ASSERT_EQUAL( NbModules, (int)anApp->modules().count() );
+
+    aTimer.restart();
+    for ( int i = 0; i < NbModules; i++ )
+      CPPUNIT_ASSERT( anApp->activateModule( ModuleTitle( i ) ) );
+    aTimer.step( aMode + " activation" );
+    CPPUNIT_ASSERT( anApp->activeModule() && anApp->activeModule()->moduleName() == ModuleTitle( NbModules - 1 ) );
+
+    anApp->closeApplication();
+  }
+
+  // each finished outermost scope is appended to the trace
+  QStringList anEvents = TraceEvents( myTraceFile );
+  CPPUNIT_ASSERT_EQUAL( 2, (int)anEvents.count( "start application CAM" ) );
+  CPPUNIT_ASSERT_EQUAL( 2, (int)anEvents.count( "initialize module Dummy0" ) );
+  CPPUNIT_ASSERT_EQUAL( 2, (int)anEvents.count( QString( "activate module %1" ).arg( ModuleTitle( NbModules - 1 ) ) ) );
+  CPPUNIT_ASSERT_EQUAL( SUIT_Profiler::nbEvents(), (int)anEvents.count() );
+
+  aTimer.note( QString( "%1 profiler events" ).arg( SUIT_Profiler::nbEvents() ) );
+  aTimer.print();
+}
+
+/*!
+  Check that recording stops when maximum number of events is reached
+*/
+void CAMTest::testProfilerLimit()
+{
+  const int aMaxEvents = SUIT_Profiler::maxEvents();
+  SUIT_Profiler::setMaxEvents( 10 );
+
+  for ( int i = 0; i < 100; i++ ) {
+    SUIT_Profiler::Scope anOuter( "outer" );
+    SUIT_Profiler::Scope anInner( "inner" );
+  }
+  SUIT_Profiler::setMaxEvents( aMaxEvents );
+
+  CPPUNIT_ASSERT_EQUAL( 10, SUIT_Profiler::nbEvents() );
+  QStringList anEvents = TraceEvents( myTraceFile );
+  CPPUNIT_ASSERT_EQUAL( 10, (int)anEvents.count() );
+  CPPUNIT_ASSERT_EQUAL( 5, (int)anEvents.count( "inner" ) );
+}
+
+/*!
+  Check that events are discarded and profiling is switched off
+  when the trace file can not be written
+*/
+void CAMTest::testProfilerUnwritable()
+{
+  SUIT_Profiler::setFileName( QDir::temp().filePath( "TestCAM_no_such_dir/trace.json" ) );
+  CPPUNIT_ASSERT( SUIT_Profiler::isEnabled() );
+  {
+    SUIT_Profiler::Scope aScope( "lost" );
+  }
+  CPPUNIT_ASSERT( !SUIT_Profiler::isEnabled() );
+
+  // scopes are not recorded any more
+  {
+    SUIT_Profiler::Scope aScope( "ignored" );
+  }
+  CPPUNIT_ASSERT_EQUAL( 1, SUIT_Profiler::nbEvents() );
+
+  // events of the unwritable file are not written to the next one
+  SUIT_Profiler::setFileName( myTraceFile );
+  {
+    SUIT_Profiler::Scope aScope( "written" );
+  }
+  QStringList anEvents = TraceEvents( myTraceFile );
+  CPPUNIT_ASSERT_EQUAL( 1, (int)anEvents.count() );
+  CPPUNIT_ASSERT( anEvents.first() == "written" );
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( CAMTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"
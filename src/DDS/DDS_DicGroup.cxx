@@ -186,17 +186,14 @@ void DDS_DicGroup::FillDataMap( const LDOM_Element& theComponentData, const LDOM
 
     aDicItem->myComponent = this;
     aDicItem->FillDataMap( anID, aQuantity, theComponentData, theDocElement, unitSystems );
-    myDataMap.Add( anID, aDicItem );
-    
-    bool exist = false;
-    for( int i=1, n=myKeys.Length(); i<=n && !exist; i++ )
-      if( myKeys.Value( i )==anID )
-      {
-        std::cout << "Doubled key:" << anID << std::endl;
-        exist = true;
-      }
-    if( !exist )
+    // keys are the same as in the item map, so the map is checked instead of the sequence
+    if ( myDataMap.Contains( anID ) )
+      std::cout << "Doubled key:" << anID << std::endl;
+    else
+    {
+      myDataMap.Add( anID, aDicItem );
       myKeys.Append( anID );
+    }
   }
 }
 
@@ -87,6 +87,7 @@ private:
   TColStd_SequenceOfAsciiString              myKeys;
 
   friend class DDS_Dictionary;
+  friend class DDS_DicItem;
 
 public:
   DEFINE_STANDARD_RTTIEXT(DDS_DicGroup, Standard_Transient)
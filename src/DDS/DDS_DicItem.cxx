@@ -49,7 +49,10 @@ DDS_DicItem::DDS_DicItem()
   myDefValue( 0 ),
   myMinZoom( 0.1 ),
   myMaxZoom( 10 ),
-  myZoomOrder( 2 )
+  myZoomOrder( 2 ),
+  myIsCached( Standard_False ),
+  myCachedData( 0 ),
+  myCanonicalData( 0 )
 {
 }
 
@@ -57,7 +60,10 @@ DDS_DicItem::DDS_DicItem()
   \brief Copy constructor (put in private section to prevent object copying).
 */
 DDS_DicItem::DDS_DicItem( const DDS_DicItem& )
-: Standard_Transient()
+: Standard_Transient(),
+  myIsCached( Standard_False ),
+  myCachedData( 0 ),
+  myCanonicalData( 0 )
 {
 }
 
@@ -342,18 +348,23 @@ TCollection_AsciiString DDS_DicItem::GetFormat( const UnitSystem& theSystem,
 
   if ( theCanonical && aFormat.Length() > 1 )
   {
-    static TCollection_AsciiString f;
-    f = aFormat;
-    Standard_Boolean isRemoved = false;
-    while ( !isRemoved )
+    // canonical form is kept for the last requested units system
+    if ( unitData != myCanonicalData )
     {
-      char ch = f.Value( f.Length() - 1 );
-      if ( ( ch != '%' && ch != '.' && !IsDigit( ch ) ) && f.Length() > 1 )
-        f.Remove( f.Length() - 1 );
-      else
-        isRemoved = true;
+      TCollection_AsciiString f = aFormat;
+      Standard_Boolean isRemoved = false;
+      while ( !isRemoved )
+      {
+        char ch = f.Value( f.Length() - 1 );
+        if ( ( ch != '%' && ch != '.' && !IsDigit( ch ) ) && f.Length() > 1 )
+          f.Remove( f.Length() - 1 );
+        else
+          isRemoved = true;
+      }
+      myCanonicalFormat = f;
+      myCanonicalData = unitData;
     }
-    aFormat = f;
+    aFormat = myCanonicalFormat;
   }
 
   return aFormat;
@@ -582,6 +593,8 @@ void DDS_DicItem::FillDataMap( TCollection_AsciiString theID, const LDOM_Element
                                const LDOM_Element& theCompElement, const LDOM_Element& theDocElement,
                                const TColStd_SequenceOfAsciiString& theSystems )
 {
+  InvalidateCache();
+
   TCollection_AsciiString aLabel    = theDatum.getAttribute( DDS_Dictionary::KeyWord( "DATUM_LABEL" ) );
   TCollection_AsciiString aFormat   = theDatum.getAttribute( DDS_Dictionary::KeyWord( "DATUM_FORMAT" ) );
   TCollection_AsciiString aFilter   = theDatum.getAttribute( DDS_Dictionary::KeyWord( "DATUM_FILTER" ) );
@@ -954,6 +967,8 @@ void DDS_DicItem::FillDataMap( TCollection_AsciiString theID, const LDOM_Element
 */
 void DDS_DicItem::GetDefaultFormat()
 {
+  InvalidateCache();
+
   for ( NCollection_DataMap<UnitSystem, UnitData>::Iterator it( myUnitData ); it.More(); it.Next() )
   {
     UnitData& anUnitData = it.ChangeValue();
@@ -1104,6 +1119,8 @@ void DDS_DicItem::GetFloatFormat( const TCollection_AsciiString& theFlags,
 */
 void DDS_DicItem::PrepareFormats( const TCollection_AsciiString& theFormat )
 {
+  InvalidateCache();
+
   for ( NCollection_DataMap<UnitSystem, UnitData>::Iterator it( myUnitData ); it.More(); it.Next() )
   {
     UnitData& anUnitData = it.ChangeValue();
@@ -1265,25 +1282,37 @@ void DDS_DicItem::Split( const TCollection_AsciiString& theStr, Handle(TColStd_H
 */
 DDS_DicItem::UnitData* DDS_DicItem::GetUnitData( const UnitSystem& sys ) const
 {
-  UnitData* unit = 0;
+  // data of the active units system is requested for almost each property
+  if ( !myIsCached || !myCachedSystem.IsEqual( sys ) )
+  {
+    myCachedSystem = sys;
+    myCachedData = myUnitData.IsBound( sys ) ? (UnitData*)&myUnitData.Find( sys ) : 0;
+    myIsCached = Standard_True;
+  }
 
-  if ( myUnitData.IsBound( sys ) )
-    unit = (UnitData*)&myUnitData.Find( sys );
+  return myCachedData;
+}
 
-  return unit;
+/*!
+  \brief Forget the cached units system data, should be called when the units data is changed.
+*/
+void DDS_DicItem::InvalidateCache()
+{
+  myIsCached = Standard_False;
+  myCachedData = 0;
+  myCanonicalData = 0;
 }
 
 /*!
   \brief Get the active units system.
   \return active units system
 */
-DDS_DicItem::UnitSystem DDS_DicItem::GetActiveUnitSystem() const
+const DDS_DicItem::UnitSystem& DDS_DicItem::GetActiveUnitSystem() const
 {
-  UnitSystem aSystem;
-  Handle(DDS_DicGroup) aComponent = Handle(DDS_DicGroup)::DownCast(myComponent);
-  if ( !aComponent.IsNull() )
-    aSystem = aComponent->GetActiveUnitSystem();
-  return aSystem;
+  static const UnitSystem aNoSystem;
+  // the name is not copied: it is compared with the cached units system at once
+  const DDS_DicGroup* aComponent = dynamic_cast<const DDS_DicGroup*>( myComponent.get() );
+  return aComponent ? aComponent->myActiveSystem : aNoSystem;
 }
 
 /*!
@@ -186,7 +186,7 @@ private:
 
   Standard_EXPORT void                               PrepareFormats( const TCollection_AsciiString& );
   Standard_EXPORT void                               GetDefaultFormat();
-  Standard_EXPORT UnitSystem                         GetActiveUnitSystem() const;
+  Standard_EXPORT const UnitSystem&                  GetActiveUnitSystem() const;
 
   Standard_EXPORT void                               GetStringFormat( const TCollection_AsciiString&,
                                                                       const TCollection_AsciiString&,
@@ -209,6 +209,7 @@ private:
                                                             Handle(TColStd_HArray1OfExtendedString)& );
 
   Standard_EXPORT UnitData*                          GetUnitData( const UnitSystem& ) const;
+  Standard_EXPORT void                               InvalidateCache();
 
 private:
   typedef NCollection_DataMap<TCollection_AsciiString, TCollection_ExtendedString> OptionsMap;
@@ -250,6 +251,13 @@ private:
   // unitData
   NCollection_DataMap<UnitSystem, UnitData>  myUnitData;
 
+  // last requested units system and its data, the active one as a rule
+  mutable Standard_Boolean                   myIsCached;
+  mutable UnitSystem                         myCachedSystem;
+  mutable UnitData*                          myCachedData;
+  mutable const UnitData*                    myCanonicalData;
+  mutable TCollection_AsciiString            myCanonicalFormat;
+
   friend class DDS_DicGroup;
 
 public:
@@ -457,6 +457,8 @@ Standard_Boolean DDS_Dictionary::Load( const TCollection_AsciiString theFileName
   if ( !aDocElement.isNull() )
     aDic->FillDataMap( aDocElement );
 
+  aDic->UpdateItemIndex();
+
   _LoadMap.Add( theFileName );
 
   return Standard_True;
@@ -517,11 +519,38 @@ Handle(DDS_DicItem) DDS_Dictionary::GetDicItem( const TCollection_AsciiString& t
 Handle(DDS_DicItem) DDS_Dictionary::GetDicItem( const TCollection_AsciiString& theID ) const
 {
   Handle(DDS_DicItem) aDicItem;
+  if ( myItemIndex.Find( theID, aDicItem ) )
+    return aDicItem;
+
+  // items added to the groups after the last update of the index
   for ( Standard_Integer i = 1; i <= myGroupMap.Extent() && aDicItem.IsNull(); i++ )
     aDicItem = myGroupMap.FindFromIndex( i )->GetDicItem( theID );
   return aDicItem;
 }
 
+/*!
+  \brief Rebuild the index of the items of all components by identifier.
+
+  The index is updated automatically when a file is loaded; descendant
+  classes which change the components contents otherwise should call this method.
+  If several components have an item with the same identifier, the item of
+  the first component is indexed, as it is the one found by GetDicItem().
+*/
+void DDS_Dictionary::UpdateItemIndex()
+{
+  myItemIndex.Clear();
+  for ( Standard_Integer i = 1; i <= myGroupMap.Extent(); i++ )
+  {
+    const Handle(DDS_DicGroup)& aDicGroup = myGroupMap.FindFromIndex( i );
+    const DDS_IndexedDataMapOfDicItems& anItems = aDicGroup->myDataMap;
+    for ( Standard_Integer j = 1; j <= anItems.Extent(); j++ )
+    {
+      if ( !myItemIndex.IsBound( anItems.FindKey( j ) ) )
+        myItemIndex.Bind( anItems.FindKey( j ), anItems.FindFromIndex( j ) );
+    }
+  }
+}
+
 /*!
   \brief Fill the internal data structures from the XML node.
   \param theDocElement document XML node
@@ -29,6 +29,8 @@
 
 #include <Standard_Transient.hxx>
 
+#include <NCollection_DataMap.hxx>
+
 class LDOM_Element;
 class TCollection_AsciiString;
 
@@ -83,9 +85,15 @@ protected:
 
   Standard_EXPORT static void                    SetDictionary(const Handle(DDS_Dictionary)& theDict);
 
+  Standard_EXPORT void                           UpdateItemIndex();
+
+protected:
+  typedef NCollection_DataMap<TCollection_AsciiString, Handle(DDS_DicItem)> ItemIndex;
+
 protected:
 
   DDS_IndexedDataMapOfDicGroups                  myGroupMap;
+  ItemIndex                                      myItemIndex;
 
 private:
 
@@ -28,6 +28,8 @@
 
 #include <QSemaphore>
 #include <QApplication>
+#include <QMutex>
+#include <QMutexLocker>
 
 // asv 21.02.05 : introducing multi-platform approach of thread comparison
 // - on Unix using pthread_t type for storing ThreadId
@@ -164,12 +166,71 @@ void SALOME_CustomEvent::setData( void* data )
   during the application initialization, i.e. from main() function.
   It is important to call this method from the primary application thread.
 
+  The semaphore used to wait for the event completion is only needed when
+  the event is posted from a secondary thread. It is taken from a pool in
+  process() and given back by the destructor, so creating and executing
+  an event in the main thread does not cost any synchronization.
+
   Caveats: 
   - there are no.
 */
 
-//! Total number of semaphore resources
-const int NumberOfResources = 2;
+//! Maximum number of unused semaphores kept in the pool
+const int MaxPoolSize = 16;
+
+/*!
+  \brief Get pool of unused semaphores.
+  \internal
+  \param mutex returns mutex protecting the pool
+  \return pool of semaphores
+*/
+static QList<QSemaphore*>& semaphorePool( QMutex*& mutex )
+{
+  static QMutex aMutex;
+  static QList<QSemaphore*> aPool;
+  mutex = &aMutex;
+  return aPool;
+}
+
+/*!
+  \brief Take a semaphore without available resources from the pool.
+  \internal
+  \return semaphore
+*/
+static QSemaphore* takeSemaphore()
+{
+  QMutex* aMutex;
+  QList<QSemaphore*>& aPool = semaphorePool( aMutex );
+  {
+    QMutexLocker aLocker( aMutex );
+    if ( !aPool.isEmpty() )
+      return aPool.takeLast();
+  }
+  return new QSemaphore( 0 );
+}
+
+/*!
+  \brief Give the semaphore back to the pool.
+  \internal
+  \param semaphore semaphore
+*/
+static void releaseSemaphore( QSemaphore* semaphore )
+{
+  // semaphore with pending resource would wake up its next user at once
+  if ( semaphore->available() > 0 )
+    semaphore->acquire( semaphore->available() );
+
+  QMutex* aMutex;
+  QList<QSemaphore*>& aPool = semaphorePool( aMutex );
+  {
+    QMutexLocker aLocker( aMutex );
+    if ( aPool.count() < MaxPoolSize ) {
+      aPool.append( semaphore );
+      return;
+    }
+  }
+  delete semaphore;
+}
 
 /*!
   \brief Initialize event mechanism.
@@ -202,19 +263,17 @@ bool SALOME_Event::IsSessionThread(){
 /*!
   \brief Constructor.
 */
-SALOME_Event::SALOME_Event(){
-  // Prepare the semaphore 
-  mySemaphore = new QSemaphore( NumberOfResources );
-  mySemaphore->acquire( NumberOfResources );
+SALOME_Event::SALOME_Event()
+  : mySemaphore( 0 )
+{
 }
 
 /*!
   \brief Destructor.
 */
 SALOME_Event::~SALOME_Event(){
-  if ( mySemaphore->available() < NumberOfResources )
-    mySemaphore->release( NumberOfResources - mySemaphore->available() );
-  delete mySemaphore;
+  if ( mySemaphore )
+    releaseSemaphore( mySemaphore );
 }
 
 /*!
@@ -247,6 +306,9 @@ void SALOME_Event::process()
     qWarning( "SALOME_Event::process() is called from the main GUI thread that might mean an error in application logic!" );
   }
 
+  if ( !mySemaphore )
+    mySemaphore = takeSemaphore();
+
   QApplication::postEvent( qApp, new SALOME_CustomEvent( SALOME_EVENT, (void*)this ) );
   mySemaphore->acquire( 1 );
 }
@@ -256,7 +318,84 @@ void SALOME_Event::process()
 */
 void SALOME_Event::processed()
 {
-  mySemaphore->release( 1 );
+  // nobody waits for the event which has not been posted by process()
+  if ( mySemaphore )
+    mySemaphore->release( 1 );
+}
+
+/*!
+  \class SALOME_EventBatch
+  \brief Event which executes several events in one dispatch
+  to the main GUI thread.
+
+  Posting many small events from a secondary thread costs an event loop
+  round-trip for each of them. Events appended to the batch are executed
+  one after another, in the order of appending, in one round-trip.
+
+  The batch takes the ownership of the appended events. Results of
+  the events can be examined after the batch processing, until the batch
+  is cleared or destroyed.
+
+  Usage:
+  \code
+  SALOME_EventBatch aBatch;
+  for ( int i = 0; i < n; i++ )
+    aBatch.append( new TVoidMemFun1ArgEvent<Foo, int>( foo, &Foo::bar, i ) );
+  ProcessEventBatch( aBatch );
+  \endcode
+*/
+
+/*!
+  \brief Constructor.
+*/
+SALOME_EventBatch::SALOME_EventBatch()
+  : SALOME_Event()
+{
+}
+
+/*!
+  \brief Destructor, deletes the events of the batch.
+*/
+SALOME_EventBatch::~SALOME_EventBatch()
+{
+  clear();
+}
+
+/*!
+  \brief Append event to the batch.
+  \param theEvent event, the batch takes its ownership
+*/
+void SALOME_EventBatch::append( SALOME_Event* theEvent )
+{
+  if ( theEvent )
+    myEvents.append( theEvent );
+}
+
+/*!
+  \brief Get number of events in the batch.
+  \return number of events
+*/
+int SALOME_EventBatch::count() const
+{
+  return myEvents.count();
+}
+
+/*!
+  \brief Delete all events of the batch.
+*/
+void SALOME_EventBatch::clear()
+{
+  qDeleteAll( myEvents );
+  myEvents.clear();
+}
+
+/*!
+  \brief Execute all events of the batch.
+*/
+void SALOME_EventBatch::Execute()
+{
+  for ( int i = 0; i < myEvents.count(); i++ )
+    myEvents[i]->Execute();
 }
 
 /*!
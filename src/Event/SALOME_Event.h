@@ -27,6 +27,7 @@
 #include "Event.h"
 
 #include <QEvent>
+#include <QList>
 
 //! SALOME custom event type
 #define SALOME_EVENT QEvent::Type( QEvent::User + 10000 )
@@ -63,7 +64,23 @@ protected:
   static void     GetSessionThread();
 
 private:
-  QSemaphore*     mySemaphore;     //!< internal semaphore
+  QSemaphore*     mySemaphore;     //!< internal semaphore, taken from the pool by process()
+};
+
+class EVENT_EXPORT SALOME_EventBatch : public SALOME_Event
+{
+public:
+  SALOME_EventBatch();
+  virtual ~SALOME_EventBatch();
+
+  void            append( SALOME_Event* );
+  int             count() const;
+  void            clear();
+
+  virtual void    Execute();
+
+private:
+  QList<SALOME_Event*> myEvents;   //!< events to be executed, owned by the batch
 };
 
 template<class TObject, typename TRes> class TMemFunEvent : public SALOME_Event
@@ -223,4 +240,14 @@ inline void ProcessVoidEvent(SALOME_Event* theEvent)
   delete theEvent;
 }
 
+inline void ProcessEventBatch(SALOME_EventBatch& theBatch)
+{
+  if(SALOME_Event::IsSessionThread()) {
+    theBatch.Execute();
+  }
+  else {
+    theBatch.process();
+  }
+}
+
 #endif // SALOME_EVENT_H
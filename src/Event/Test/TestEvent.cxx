@@ -0,0 +1,222 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "SALOME_Event.h"
+#include "SALOME_EventFilter.h"
+
+#include <QEventLoop>
+#include <QThread>
+
+/*
+  Class       : Counter
+  Description : Object modified by events in the main thread
+*/
+class Counter
+{
+public:
+  Counter() : myValue( 0 ), myIsMainThread( true ) {}
+
+  int add( int theValue )
+  {
+    myIsMainThread = myIsMainThread && SALOME_Event::IsSessionThread();
+    return myValue += theValue;
+  }
+
+  int  value() const { return myValue; }
+  bool isMainThread() const { return myIsMainThread; }
+
+private:
+  int  myValue;
+  bool myIsMainThread;
+};
+
+typedef TMemFun1ArgEvent<Counter, int, int> TAddEvent;
+
+/*
+  Class       : Caller
+  Description : Secondary thread processing events
+*/
+class Caller : public QThread
+{
+public:
+  Caller( Counter* theCounter, int theNbCalls, bool theIsBatch = false )
+    : myCounter( theCounter ), myNbCalls( theNbCalls ), myIsBatch( theIsBatch ), myLastResult( 0 ) {}
+
+  int lastResult() const { return myLastResult; }
+
+  //! Run the thread and process events of the main thread until it is finished
+  void exec()
+  {
+    QEventLoop aLoop;
+    QObject::connect( this, &QThread::finished, &aLoop, &QEventLoop::quit );
+    start();
+    aLoop.exec();
+    wait();
+  }
+
+protected:
+  virtual void run()
+  {
+    if ( myIsBatch ) {
+      // all events are executed in one round-trip to the main thread
+      SALOME_EventBatch aBatch;
+      TAddEvent* anEvent = 0;
+      for ( int i = 0; i < myNbCalls; i++ )
+        aBatch.append( anEvent = new TAddEvent( myCounter, &Counter::add, 1 ) );
+      ProcessEventBatch( aBatch );
+      myLastResult = anEvent ? anEvent->myResult : 0;
+    }
+    else {
+      for ( int i = 0; i < myNbCalls; i++ )
+        myLastResult = ProcessEvent( new TAddEvent( myCounter, &Counter::add, 1 ) );
+    }
+  }
+
+private:
+  Counter* myCounter;
+  int      myNbCalls;
+  bool     myIsBatch;
+  int      myLastResult;
+};
+
+/*!
+  \class EventTest: test suit
+*/
+class EventTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( EventTest );
+  CPPUNIT_TEST( testProcessEvent );
+  CPPUNIT_TEST( testProcessEventBatch );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+  void testProcessEvent();
+  void testProcessEventBatch();
+};
+
+/*!
+  Set up each test case
+*/
+void EventTest::setUp()
+{
+  GuiTest_Fixture::setUp();
+  SALOME_EventFilter::Init();
+}
+
+/*!
+  Clean-up each test case
+*/
+void EventTest::tearDown()
+{
+  SALOME_EventFilter::Destroy();
+  GuiTest_Fixture::tearDown();
+}
+
+/*!
+  Check results of events and measure number of events processed per second
+  when called from the main thread and from a secondary thread
+*/
+void EventTest::testProcessEvent()
+{
+  const int aNbCalls = 100000;
+
+  CPPUNIT_ASSERT( SALOME_Event::IsSessionThread() );
+
+  GuiTest_Timer aTimer( QString( "ProcessEvent, %1 calls" ).arg( aNbCalls ) );
+
+  // main thread: events are executed in place
+  Counter aCounter;
+  int aResult = 0;
+  for ( int i = 0; i < aNbCalls; i++ )
+    aResult = ProcessEvent( new TAddEvent( &aCounter, &Counter::add, 1 ) );
+  qint64 aMainTime = aTimer.step( "main thread" );
+  CPPUNIT_ASSERT_EQUAL( aNbCalls, aResult );
+
+  // secondary thread: each event is a round-trip to the main thread event loop
+  Caller aCaller( &aCounter, aNbCalls );
+  aTimer.restart();
+  aCaller.exec();
+  qint64 aThreadTime = aTimer.step( "secondary thread" );
+
+  CPPUNIT_ASSERT_EQUAL( 2 * aNbCalls, aCaller.lastResult() );
+  CPPUNIT_ASSERT_EQUAL( 2 * aNbCalls, aCounter.value() );
+  CPPUNIT_ASSERT( aCounter.isMainThread() );
+
+  aTimer.note( QString( "%1 calls/sec from the main thread" ).arg( aNbCalls * 1000LL / aMainTime ) );
+  aTimer.note( QString( "%1 calls/sec from a secondary thread" ).arg( aNbCalls * 1000LL / aThreadTime ) );
+  aTimer.print();
+}
+
+/*!
+  Compare N events posted one by one from a secondary thread with
+  the same N events posted as one batch
+*/
+void EventTest::testProcessEventBatch()
+{
+  const int aNbCalls = 100000;
+
+  GuiTest_Timer aTimer( QString( "ProcessEventBatch, %1 events from a secondary thread" ).arg( aNbCalls ) );
+
+  // N dispatches to the main thread
+  Counter aSingleCounter;
+  Caller aSingleCaller( &aSingleCounter, aNbCalls );
+  aTimer.restart();
+  aSingleCaller.exec();
+  qint64 aSingleTime = aTimer.step( "single dispatches" );
+
+  CPPUNIT_ASSERT_EQUAL( aNbCalls, aSingleCaller.lastResult() );
+  CPPUNIT_ASSERT( aSingleCounter.isMainThread() );
+
+  // one dispatch to the main thread
+  Counter aBatchCounter;
+  Caller aBatchCaller( &aBatchCounter, aNbCalls, true );
+  aTimer.restart();
+  aBatchCaller.exec();
+  qint64 aBatchTime = aTimer.step( "one batched dispatch" );
+
+  // events of the batch are executed in the main thread, in order of appending
+  CPPUNIT_ASSERT_EQUAL( aNbCalls, aBatchCaller.lastResult() );
+  CPPUNIT_ASSERT_EQUAL( aNbCalls, aBatchCounter.value() );
+  CPPUNIT_ASSERT( aBatchCounter.isMainThread() );
+
+  // batch is executed in place when processed from the main thread
+  SALOME_EventBatch aBatch;
+  for ( int i = 0; i < 10; i++ )
+    aBatch.append( new TAddEvent( &aBatchCounter, &Counter::add, 1 ) );
+  CPPUNIT_ASSERT_EQUAL( 10, aBatch.count() );
+  ProcessEventBatch( aBatch );
+  CPPUNIT_ASSERT_EQUAL( aNbCalls + 10, aBatchCounter.value() );
+  aBatch.clear();
+  CPPUNIT_ASSERT_EQUAL( 0, aBatch.count() );
+
+  aTimer.note( QString( "speed-up x%1" ).arg( (double)aSingleTime / aBatchTime, 0, 'f', 1 ) );
+  aTimer.print();
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( EventTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"
@@ -11,8 +11,12 @@ static const int PADDING       = 10;
 static const int BTN_W         = 90;
 static const int BTN_H         = 26;
 
+static const int CACHE_SIZE    = 1024;
+
 ExtensionDelegate::ExtensionDelegate(QObject *parent)
     : QStyledItemDelegate(parent)
+    , m_iconCache(CACHE_SIZE)
+    , m_layoutCache(CACHE_SIZE)
 {}
 
 // ── Geometry helpers ─────────────────────────────────────────
@@ -24,6 +28,72 @@ QRect ExtensionDelegate::installButtonRect(const QStyleOptionViewItem &option) c
                  BTN_W, BTN_H);
 }
 
+// ── Cached parts of the rows ─────────────────────────────────
+
+QPixmap ExtensionDelegate::iconBadge(const QString &id, const QString &letter,
+                                     const QFont &font) const
+{
+    const QString key = id + QLatin1Char('\n') + letter + QLatin1Char('\n') + font.key();
+    if (QPixmap *cached = m_iconCache.object(key))
+        return *cached;
+
+    QPixmap *badge = new QPixmap(ICON_SIZE, ICON_SIZE);
+    // Derive a colour from the extension id for variety
+    uint hash = qHash(id);
+    badge->fill(QColor::fromHsv(hash % 360, 180, 200));
+
+    QPainter p(badge);
+    p.setPen(Qt::white);
+    QFont iconFont = font;
+    iconFont.setPointSize(18);
+    iconFont.setBold(true);
+    p.setFont(iconFont);
+    p.drawText(badge->rect(), Qt::AlignCenter, letter);
+    p.end();
+
+    QPixmap result = *badge;
+    m_iconCache.insert(key, badge);
+    return result;
+}
+
+const ExtensionDelegate::RowLayout &
+ExtensionDelegate::rowLayout(const QModelIndex &index, const QFont &boldFont,
+                             const QFont &smallFont, int textW) const
+{
+    const QString id      = index.data(ExtensionModel::IdRole).toString();
+    const QString name    = index.data(Qt::DisplayRole).toString();
+    const QString version = index.data(ExtensionModel::VersionRole).toString();
+    const QString author  = index.data(ExtensionModel::AuthorRole).toString();
+    const QString desc    = index.data(ExtensionModel::DescriptionRole).toString();
+    const int     installs = index.data(ExtensionModel::InstallsRole).toInt();
+    const QString fontKey = boldFont.key() + QLatin1Char('\n') + smallFont.key();
+
+    RowLayout *layout = m_layoutCache.object(id);
+    if (layout && layout->width == textW && layout->fontKey == fontKey &&
+        layout->name == name && layout->version == version &&
+        layout->author == author && layout->description == desc &&
+        layout->installCount == installs)
+        return *layout;
+
+    if (!layout) {
+        layout = new RowLayout;
+        m_layoutCache.insert(id, layout);
+    }
+    layout->fontKey     = fontKey;
+    layout->width       = textW;
+    layout->name        = name;
+    layout->version     = version;
+    layout->author      = author;
+    layout->description = desc;
+    layout->installCount = installs;
+    layout->elidedName  = QFontMetrics(boldFont).elidedText(name, Qt::ElideRight, textW - 60);
+    layout->elidedDescription = QFontMetrics(smallFont).elidedText(desc, Qt::ElideRight, textW);
+    layout->installs = (installs >= 1000
+        ? QString("%1K").arg(installs / 1000)
+        : QString::number(installs)) + " installs";
+    return *layout;
+}
+
 // ── Paint ─────────────────────────────────────────────────────
 
 void ExtensionDelegate::paint(QPainter *painter,
@@ -50,72 +120,56 @@ void ExtensionDelegate::paint(QPainter *painter,
 
     // ── Icon placeholder ─────────────────────────────────────
     QRect iconRect(x0, y0, ICON_SIZE, ICON_SIZE);
-    // Derive a colour from the extension id for variety
-    QString id = index.data(ExtensionModel::IdRole).toString();
-    uint hash = qHash(id);
-    QColor iconColor = QColor::fromHsv(hash % 360, 180, 200);
-    painter->fillRect(iconRect, iconColor);
-    painter->setPen(Qt::white);
-    QFont iconFont = painter->font();
-    iconFont.setPointSize(18);
-    iconFont.setBold(true);
-    painter->setFont(iconFont);
-    painter->drawText(iconRect, Qt::AlignCenter,
-                      index.data(Qt::DisplayRole).toString().left(1).toUpper());
+    painter->drawPixmap(iconRect,
+                        iconBadge(index.data(ExtensionModel::IdRole).toString(),
+                                  index.data(Qt::DisplayRole).toString().left(1).toUpper(),
+                                  painter->font()));
 
     // ── Text area ────────────────────────────────────────────
     const int textX = x0 + ICON_SIZE + PADDING;
     const int textW = option.rect.right() - BTN_W - PADDING * 2 - textX;
 
-    // Name + version
-    QString name    = index.data(Qt::DisplayRole).toString();
-    QString version = index.data(ExtensionModel::VersionRole).toString();
-    QString author  = index.data(ExtensionModel::AuthorRole).toString();
-    QString desc    = index.data(ExtensionModel::DescriptionRole).toString();
     double  rating  = index.data(ExtensionModel::RatingRole).toDouble();
-    int     installs= index.data(ExtensionModel::InstallsRole).toInt();
     bool    installed = index.data(ExtensionModel::InstalledRole).toBool();
 
     QFont boldFont = painter->font();
     boldFont.setPointSize(10);
     boldFont.setBold(true);
+    QFont smallFont = boldFont;
+    smallFont.setPointSize(8);
+    smallFont.setBold(false);
+
+    const RowLayout &layout = rowLayout(index, boldFont, smallFont, textW);
+
+    // Name + version
     painter->setFont(boldFont);
     painter->setPen(QColor("#cccccc"));
     QRect nameRect(textX, y0, textW - 60, 20);
-    painter->drawText(nameRect, Qt::AlignLeft | Qt::AlignVCenter,
-                      QFontMetrics(boldFont).elidedText(name, Qt::ElideRight, nameRect.width()));
+    painter->drawText(nameRect, Qt::AlignLeft | Qt::AlignVCenter, layout.elidedName);
 
     // Version badge
-    QFont smallFont = boldFont;
-    smallFont.setPointSize(8);
-    smallFont.setBold(false);
     painter->setFont(smallFont);
     painter->setPen(QColor("#888888"));
     painter->drawText(QRect(nameRect.right(), y0, 60, 20),
-                      Qt::AlignLeft | Qt::AlignVCenter, "v" + version);
+                      Qt::AlignLeft | Qt::AlignVCenter, "v" + layout.version);
 
     // Author
     painter->setPen(QColor("#75beff"));
     painter->drawText(QRect(textX, y0 + 20, textW, 16),
-                      Qt::AlignLeft | Qt::AlignVCenter, author);
+                      Qt::AlignLeft | Qt::AlignVCenter, layout.author);
 
     // Description
     painter->setPen(QColor("#9d9d9d"));
-    QFontMetrics fm(smallFont);
-    QString elidedDesc = fm.elidedText(desc, Qt::ElideRight, textW);
     painter->drawText(QRect(textX, y0 + 36, textW, 16),
-                      Qt::AlignLeft | Qt::AlignVCenter, elidedDesc);
+                      Qt::AlignLeft | Qt::AlignVCenter, layout.elidedDescription);
 
     // Stars + install count
     QRectF starsRect(textX, y0 + 55, 80, 14);
     drawStars(painter, starsRect, rating);
     painter->setPen(QColor("#888888"));
-    QString installStr = installs >= 1000
-        ? QString("%1K").arg(installs / 1000)
-        : QString::number(installs);
+    painter->setFont(smallFont);
     painter->drawText(QRect(textX + 86, y0 + 54, 100, 16),
-                      Qt::AlignLeft | Qt::AlignVCenter,
-                      installStr + " installs");
+                      Qt::AlignLeft | Qt::AlignVCenter, layout.installs);
 
     // ── Install button ───────────────────────────────────────
     QRect btnRect = installButtonRect(option);
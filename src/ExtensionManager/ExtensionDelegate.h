@@ -1,5 +1,7 @@
 #pragma once
 #include <QStyledItemDelegate>
+#include <QCache>
+#include <QPixmap>
 
 // ─────────────────────────────────────────────────────────────
 // ExtensionDelegate
@@ -10,6 +12,9 @@
 //   • Short description
 //   • Star rating + install count
 //   • "Install" / "Installed ✓" badge on the right
+//
+//   Icon badges and elided texts of the rows are cached, so a
+//   repaint of an unchanged row does not lay its text out again.
 // ─────────────────────────────────────────────────────────────
 class ExtensionDelegate : public QStyledItemDelegate
 {
@@ -36,6 +41,22 @@ signals:
     void uninstallRequested(const QModelIndex &index);
 
 private:
-    QRect installButtonRect(const QStyleOptionViewItem &option) const;
-    void  drawStars(QPainter *p, const QRectF &rect, double rating) const;
+    // Texts of a row, elided to the width of its text area
+    struct RowLayout
+    {
+        QString fontKey;
+        int     width = 0;
+        QString name, version, author, description;   // source texts
+        int     installCount = -1;
+        QString elidedName, elidedDescription, installs;
+    };
+
+    QRect   installButtonRect(const QStyleOptionViewItem &option) const;
+    void    drawStars(QPainter *p, const QRectF &rect, double rating) const;
+    QPixmap iconBadge(const QString &id, const QString &letter, const QFont &font) const;
+    const RowLayout &rowLayout(const QModelIndex &index, const QFont &boldFont,
+                               const QFont &smallFont, int textW) const;
+
+    mutable QCache<QString, QPixmap>   m_iconCache;     // by id and letter
+    mutable QCache<QString, RowLayout> m_layoutCache;   // by id
 };
@@ -9,16 +9,36 @@
 ExtensionFetcher::ExtensionFetcher(QObject *parent)
     : QObject(parent)
     , m_nam(new QNetworkAccessManager(this))
-{}
+    , m_searchCache(32)
+{
+    m_clock.start();
+}
 
 // ── Public API ────────────────────────────────────────────────
 
 void ExtensionFetcher::search(const QString &keyword, const QUrl &serverUrl)
 {
+    const QString normalized = normalizeKeyword(keyword);
+    const QString key = cacheKey(serverUrl, normalized);
+
+    // Same query is already on its way: nothing to do
+    if (m_searchReply && m_searchKey == key)
+        return;
+
+    // Any previous search is superseded by this one
+    cancelSearch();
+    const quint64 generation = ++m_searchGeneration;
+
+    QList<Extension> cached;
+    if (findCached(serverUrl, normalized, cached)) {
+        emit extensionsFetched(cached);
+        return;
+    }
+
     QUrl url = serverUrl;
     // Append the keyword as a query parameter: GET /extensions?q=<keyword>
     QUrlQuery query;
-    query.addQueryItem("q", keyword);
+    query.addQueryItem("q", normalized);
     url.setQuery(query);
 
     QNetworkRequest request(url);
@@ -27,10 +47,56 @@ void ExtensionFetcher::search(const QString &keyword, const QUrl &serverUrl)
                          QNetworkRequest::NoLessSafeRedirectPolicy);
 
     QNetworkReply *reply = m_nam->get(request);
+    reply->setProperty("generation", generation);
+    reply->setProperty("cacheKey", key);
+    m_searchReply = reply;
+    m_searchKey = key;
+    m_searchRequests++;
     connect(reply, &QNetworkReply::finished,
             this,  &ExtensionFetcher::onSearchReplyFinished);
 }
 
+void ExtensionFetcher::cancelSearch()
+{
+    ++m_searchGeneration;
+    if (m_searchReply) {
+        QNetworkReply *reply = m_searchReply;
+        m_searchReply = nullptr;
+        m_searchKey.clear();
+        reply->abort();
+    }
+}
+
+void ExtensionFetcher::clearCache()
+{
+    m_searchCache.clear();
+}
+
+void ExtensionFetcher::setCacheSize(int size)
+{
+    m_searchCache.setMaxCost(qMax(size, 0));
+}
+
+int ExtensionFetcher::cacheSize() const
+{
+    return m_searchCache.maxCost();
+}
+
+void ExtensionFetcher::setCacheTimeToLive(int msec)
+{
+    m_cacheTtl = qMax(msec, 0);
+}
+
+int ExtensionFetcher::cacheTimeToLive() const
+{
+    return m_cacheTtl;
+}
+
+int ExtensionFetcher::searchRequestCount() const
+{
+    return m_searchRequests;
+}
+
 void ExtensionFetcher::installExtension(const Extension &ext, const QUrl &serverUrl)
 {
     // Build URL:  GET /install?id=<ext.id>
@@ -83,6 +149,13 @@ void ExtensionFetcher::onSearchReplyFinished()
     if (!reply) return;
     reply->deleteLater();
 
+    // Reply of an aborted or superseded search: drop it
+    if (reply != m_searchReply ||
+        reply->property("generation").toULongLong() != m_searchGeneration)
+        return;
+    m_searchReply = nullptr;
+    m_searchKey.clear();
+
     if (reply->error() != QNetworkReply::NoError) {
         emit fetchError(reply->errorString());
         return;
@@ -90,6 +163,8 @@ void ExtensionFetcher::onSearchReplyFinished()
 
     QByteArray data = reply->readAll();
     QList<Extension> extensions = parseJson(data);
+    m_searchCache.insert(reply->property("cacheKey").toString(),
+                         new CachedResult{extensions, m_clock.elapsed()});
     emit extensionsFetched(extensions);
 }
 
@@ -100,6 +175,8 @@ void ExtensionFetcher::onInstallReplyFinished()
     reply->deleteLater();
 
     bool ok = (reply->error() == QNetworkReply::NoError);
+    if (ok)
+        setInstalled(m_pendingInstallId, true);
     emit installFinished(m_pendingInstallId, ok);
     if (!ok)
         emit fetchError(tr("Installation failed: ") + reply->errorString());
@@ -112,11 +189,95 @@ void ExtensionFetcher::onUninstallReplyFinished()
     reply->deleteLater();
 
     bool ok = (reply->error() == QNetworkReply::NoError);
+    if (ok)
+        setInstalled(m_pendingInstallId, false);
     emit uninstallFinished(m_pendingInstallId, ok);
     if (!ok)
         emit fetchError(tr("Uninstallation failed: ") + reply->errorString());
 }
 
+// ── Search cache ──────────────────────────────────────────────
+
+QString ExtensionFetcher::normalizeKeyword(const QString &keyword)
+{
+    return keyword.trimmed().toLower();
+}
+
+QString ExtensionFetcher::cacheKey(const QUrl &serverUrl, const QString &keyword)
+{
+    return serverUrl.toString() + QLatin1Char('\n') + keyword;
+}
+
+// Same rule as the catalogue server: the keyword is a part of the
+// name, description, author or of one of the tags
+bool ExtensionFetcher::matches(const Extension &ext, const QString &keyword)
+{
+    if (keyword.isEmpty())
+        return true;
+    if (ext.name.contains(keyword, Qt::CaseInsensitive) ||
+        ext.description.contains(keyword, Qt::CaseInsensitive) ||
+        ext.author.contains(keyword, Qt::CaseInsensitive))
+        return true;
+    for (const QString &tag : ext.tags)
+        if (tag.contains(keyword))
+            return true;
+    return false;
+}
+
+// Results of a query are looked for in the cache; if they are not there,
+// they are filtered from the results of the longest cached query which is
+// a prefix of this one (any extension matching the query matches its prefix).
+// Expired results are removed, so that the server is asked again.
+bool ExtensionFetcher::findCached(const QUrl &serverUrl, const QString &keyword,
+                                  QList<Extension> &result)
+{
+    for (const QString &cachedKey : m_searchCache.keys())
+        if (isExpired(m_searchCache.object(cachedKey)))
+            m_searchCache.remove(cachedKey);
+
+    const QString key = cacheKey(serverUrl, keyword);
+    if (CachedResult *exact = m_searchCache.object(key)) {
+        result = exact->extensions;
+        return true;
+    }
+
+    const QString server = cacheKey(serverUrl, QString());
+    QString bestKey;
+    for (const QString &cachedKey : m_searchCache.keys()) {
+        if (cachedKey.length() > bestKey.length() &&
+            cachedKey.startsWith(server) && key.startsWith(cachedKey))
+            bestKey = cachedKey;
+    }
+    if (bestKey.isEmpty())
+        return false;
+
+    // refined results expire together with the ones they come from
+    const CachedResult *best = m_searchCache.object(bestKey);
+    result.clear();
+    for (const Extension &ext : best->extensions)
+        if (matches(ext, keyword))
+            result.append(ext);
+    m_searchCache.insert(key, new CachedResult{result, best->fetchedAt});
+    return true;
+}
+
+bool ExtensionFetcher::isExpired(const CachedResult *entry) const
+{
+    return entry && m_cacheTtl > 0 && m_clock.elapsed() - entry->fetchedAt > m_cacheTtl;
+}
+
+// The extension is (un)installed on this machine, so its cached
+// results are still valid, except for the "installed" flag
+void ExtensionFetcher::setInstalled(const QString &extId, bool installed)
+{
+    for (const QString &cachedKey : m_searchCache.keys()) {
+        CachedResult *entry = m_searchCache.object(cachedKey);
+        for (Extension &ext : entry->extensions)
+            if (ext.id == extId)
+                ext.installed = installed;
+    }
+}
+
 // ── JSON parser ───────────────────────────────────────────────
 
 QList<Extension> ExtensionFetcher::parseJson(const QByteArray &data)
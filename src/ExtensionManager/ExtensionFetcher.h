@@ -2,6 +2,9 @@
 #include <QObject>
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
+#include <QCache>
+#include <QElapsedTimer>
+#include <QPointer>
 #include <QUrl>
 #include "Extension.h"
 
@@ -24,6 +27,16 @@
 //     },
 //     ...
 //   ]
+//
+//   Searches:
+//     - a new search aborts the one still in flight, so results
+//       are never delivered out of typing order;
+//     - results are kept in an LRU cache keyed by server URL and
+//       normalized (trimmed, lower-case) query, for a limited time;
+//     - a query extending a cached one is answered by filtering
+//       the cached results on the client, without a request;
+//     - installing or uninstalling an extension updates its
+//       "installed" flag in the cached results.
 // ─────────────────────────────────────────────────────────────
 class ExtensionFetcher : public QObject
 {
@@ -33,8 +46,26 @@ public:
     explicit ExtensionFetcher(QObject *parent = nullptr);
 
     /// Trigger an asynchronous search.  Results arrive via extensionsFetched().
+    /// Results already known are delivered at once.
     void search(const QString &keyword, const QUrl &serverUrl);
 
+    /// Abort the search in flight, if any.
+    void cancelSearch();
+
+    /// Forget the cached search results.
+    void clearCache();
+
+    /// Number of cached search results.
+    void setCacheSize(int size);
+    int  cacheSize() const;
+
+    /// Time (in ms) during which cached results are used; 0 means no limit.
+    void setCacheTimeToLive(int msec);
+    int  cacheTimeToLive() const;
+
+    /// Number of search requests sent to the server.
+    int  searchRequestCount() const;
+
     /// Download / install an extension (placeholder – real impl would fetch a
     /// package archive and unpack it).
     void installExtension(const Extension &ext, const QUrl &serverUrl);
@@ -55,8 +86,30 @@ private slots:
     void onUninstallReplyFinished();
 
 private:
+    struct CachedResult
+    {
+        QList<Extension> extensions;
+        qint64           fetchedAt;   // m_clock time of the server answer
+    };
+
     QList<Extension> parseJson(const QByteArray &data);
 
+    static QString normalizeKeyword(const QString &keyword);
+    static QString cacheKey(const QUrl &serverUrl, const QString &keyword);
+    static bool    matches(const Extension &ext, const QString &keyword);
+    bool           findCached(const QUrl &serverUrl, const QString &keyword,
+                              QList<Extension> &result);
+    bool           isExpired(const CachedResult *entry) const;
+    void           setInstalled(const QString &extId, bool installed);
+
     QNetworkAccessManager *m_nam;
     QString                m_pendingInstallId;
+
+    QPointer<QNetworkReply>          m_searchReply;      // search in flight
+    QString                          m_searchKey;        // its cache key
+    quint64                          m_searchGeneration = 0;
+    int                              m_searchRequests   = 0;
+    QCache<QString, CachedResult>    m_searchCache;      // LRU, one result list costs 1
+    QElapsedTimer                    m_clock;            // time base of the cache
+    int                              m_cacheTtl = 5 * 60 * 1000;
 };
@@ -1,4 +1,6 @@
 #include "ExtensionModel.h"
+#include <QHash>
+#include <QSet>
 
 ExtensionModel::ExtensionModel(QObject *parent)
     : QAbstractListModel(parent)
@@ -48,9 +50,110 @@ QHash<int, QByteArray> ExtensionModel::roleNames() const
 
 void ExtensionModel::setExtensions(const QList<Extension> &extensions)
 {
-    beginResetModel();
-    m_extensions = extensions;
-    endResetModel();
+    QSet<QString> newIds;
+    for (const Extension &ext : extensions)
+        newIds.insert(ext.id);
+
+    // Ids must identify rows, otherwise fall back to a reset
+    if (newIds.size() != extensions.size()) {
+        beginResetModel();
+        m_extensions = extensions;
+        endResetModel();
+        return;
+    }
+
+    // 1. Remove rows which are not in the new list, by contiguous ranges
+    for (int last = m_extensions.size() - 1; last >= 0; ) {
+        if (newIds.contains(m_extensions[last].id)) { --last; continue; }
+        int first = last;
+        while (first > 0 && !newIds.contains(m_extensions[first - 1].id))
+            --first;
+        beginRemoveRows(QModelIndex(), first, last);
+        m_extensions.erase(m_extensions.begin() + first, m_extensions.begin() + last + 1);
+        endRemoveRows();
+        last = first - 1;
+    }
+
+    // 2. Put the kept rows in the order of the new list at once:
+    //    a layout change instead of a move per row
+    QHash<QString, int> order;   // id -> row among the kept ones
+    for (const Extension &ext : m_extensions)
+        order.insert(ext.id, -1);
+    int keptRow = 0;
+    for (const Extension &ext : extensions) {
+        auto it = order.find(ext.id);
+        if (it != order.end())
+            *it = keptRow++;
+    }
+
+    bool reordered = false;
+    for (int row = 0; row < m_extensions.size() && !reordered; ++row)
+        reordered = order.value(m_extensions[row].id) != row;
+
+    if (reordered) {
+        emit layoutAboutToBeChanged();
+        QList<Extension> sorted = m_extensions;
+        for (const Extension &ext : m_extensions)
+            sorted[order.value(ext.id)] = ext;
+
+        const QModelIndexList from = persistentIndexList();
+        QModelIndexList to;
+        for (const QModelIndex &idx : from)
+            to << index(order.value(m_extensions[idx.row()].id));
+        changePersistentIndexList(from, to);
+
+        m_extensions = sorted;
+        emit layoutChanged();
+    }
+
+    // 3. Walk the new list: update the kept rows, insert the new ones
+    int changedFirst = -1, changedLast = -1;
+    auto flushChanged = [&]() {
+        if (changedFirst >= 0)
+            emit dataChanged(index(changedFirst), index(changedLast));
+        changedFirst = changedLast = -1;
+    };
+
+    for (int row = 0; row < extensions.size(); ) {
+        const Extension &ext = extensions[row];
+        if (row < m_extensions.size() && m_extensions[row].id == ext.id) {
+            if (!sameData(m_extensions[row], ext)) {
+                m_extensions[row] = ext;
+                if (changedFirst < 0) changedFirst = row;
+                changedLast = row;
+            } else {
+                flushChanged();
+            }
+            ++row;
+            continue;
+        }
+        flushChanged();
+
+        // Insert all the consecutive new extensions at once
+        int count = 1;
+        while (row + count < extensions.size() &&
+               !order.contains(extensions[row + count].id))
+            ++count;
+        beginInsertRows(QModelIndex(), row, row + count - 1);
+        for (int i = 0; i < count; ++i)
+            m_extensions.insert(row + i, extensions[row + i]);
+        endInsertRows();
+        row += count;
+    }
+    flushChanged();
+}
+
+bool ExtensionModel::sameData(const Extension &a, const Extension &b)
+{
+    return a.name        == b.name        &&
+           a.version     == b.version     &&
+           a.author      == b.author      &&
+           a.description == b.description &&
+           a.tags        == b.tags        &&
+           a.iconUrl     == b.iconUrl     &&
+           a.rating      == b.rating      &&
+           a.installs    == b.installs    &&
+           a.installed   == b.installed;
 }
 
 void ExtensionModel::markInstalled(const QString &extId)
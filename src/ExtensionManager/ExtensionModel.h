@@ -5,6 +5,11 @@
 // ─────────────────────────────────────────────────────────────
 // ExtensionModel – QAbstractListModel holding a list of
 // Extension objects fetched from the remote server.
+//
+//   A new list is merged into the current one by Extension::id:
+//   views get row removals, a single layout change for the new
+//   order, insertions and dataChanged() instead of a reset, so
+//   selection and scrolling are kept.
 // ─────────────────────────────────────────────────────────────
 class ExtensionModel : public QAbstractListModel
 {
@@ -40,5 +45,7 @@ public:
     bool isInstalled(const QString &extId) const;
 
 private:
+    static bool sameData(const Extension &a, const Extension &b);
+
     QList<Extension> m_extensions;
 };
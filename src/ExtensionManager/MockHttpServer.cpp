@@ -5,6 +5,7 @@
 #include <QUrlQuery>
 #include <QUrl>
 #include <QDebug>
+#include <QTimer>
 
 // ── Static catalogue ─────────────────────────────────────────
 
@@ -130,6 +131,21 @@ quint16 MockHttpServer::port() const
     return m_server->serverPort();
 }
 
+void MockHttpServer::setLatency(int msec)
+{
+    m_latency = qMax(msec, 0);
+}
+
+int MockHttpServer::latency() const
+{
+    return m_latency;
+}
+
+int MockHttpServer::requestCount() const
+{
+    return m_requests;
+}
+
 void MockHttpServer::onNewConnection()
 {
     while (m_server->hasPendingConnections()) {
@@ -147,9 +163,14 @@ void MockHttpServer::onReadyRead()
     if (!socket) return;
 
     QByteArray request = socket->readAll();
-    handleRequest(socket, request);
-    socket->flush();
-    socket->disconnectFromHost();
+    m_requests++;
+
+    // The answer is cancelled if the client closes the connection meanwhile
+    QTimer::singleShot(m_latency, socket, [this, socket, request]() {
+        handleRequest(socket, request);
+        socket->flush();
+        socket->disconnectFromHost();
+    });
 }
 
 void MockHttpServer::handleRequest(QTcpSocket *socket, const QByteArray &request)
@@ -168,8 +189,8 @@ void MockHttpServer::handleRequest(QTcpSocket *socket, const QByteArray &request
         QString keyword = query.queryItemValue("q");
         QByteArray json = buildCatalogueJson(keyword);
         sendJson(socket, json);
-    } else if (path == "/install") {
-        // Just return 200 OK for any install request
+    } else if (path == "/install" || path == "/uninstall") {
+        // Just return 200 OK for any install or uninstall request
         QByteArray body = R"({"status":"ok"})";
         sendJson(socket, body);
     } else {
@@ -12,6 +12,9 @@
 //   Endpoints:
 //     GET /extensions?q=<keyword>  → JSON array (filtered)
 //     GET /install?id=<extId>      → 200 OK (simulated install)
+//     GET /uninstall?id=<extId>    → 200 OK (simulated uninstall)
+//
+//   A latency can be injected to simulate a slow server.
 // ─────────────────────────────────────────────────────────────
 class MockHttpServer : public QObject
 {
@@ -25,6 +28,13 @@ public:
 
     quint16 port() const;
 
+    /// Delay (in ms) before answering each request.
+    void setLatency(int msec);
+    int  latency() const;
+
+    /// Number of requests received since start.
+    int  requestCount() const;
+
 private slots:
     void onNewConnection();
     void onReadyRead();
@@ -37,4 +47,6 @@ private:
     QByteArray buildCatalogueJson(const QString &keyword) const;
 
     QTcpServer *m_server;
+    int         m_latency  = 0;
+    int         m_requests = 0;
 };
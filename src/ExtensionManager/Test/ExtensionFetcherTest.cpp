@@ -0,0 +1,232 @@
+// ─────────────────────────────────────────────────────────────
+// ExtensionFetcherTest
+//   Simulates typing in the search field against MockHttpServer
+//   with an injected latency and checks that:
+//     - only the results of the last query are delivered;
+//     - a query extending an already fetched one is answered
+//       without any request to the server;
+//     - installation and uninstallation update the cached results;
+//     - expired results are fetched from the server again.
+//   Prints the number of requests issued and the time needed
+//   to get the correct results.
+// ─────────────────────────────────────────────────────────────
+#include "ExtensionFetcher.h"
+#include "MockHttpServer.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <cstdio>
+#include <functional>
+
+namespace
+{
+    const int LATENCY   = 200;  // server latency, ms
+    const int KEYSTROKE = 50;   // delay between keystrokes, ms
+    const int TIMEOUT   = 5000; // maximum waiting time, ms
+
+    bool waitFor(const std::function<bool()> &condition)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (!condition() && timer.elapsed() < TIMEOUT) {
+            QCoreApplication::processEvents();
+            QThread::msleep(1);
+        }
+        return condition();
+    }
+
+    QStringList ids(const QList<Extension> &extensions)
+    {
+        QStringList result;
+        for (const Extension &ext : extensions)
+            result << ext.id;
+        return result;
+    }
+
+    // Runs the search and waits for its results
+    QList<Extension> fetch(ExtensionFetcher &fetcher, const QUrl &url, const QString &keyword)
+    {
+        QList<Extension> result;
+        bool fetched = false;
+        QMetaObject::Connection connection =
+            QObject::connect(&fetcher, &ExtensionFetcher::extensionsFetched,
+                             [&](const QList<Extension> &extensions) {
+                result = extensions;
+                fetched = true;
+            });
+        fetcher.search(keyword, url);
+        waitFor([&]() { return fetched; });
+        QObject::disconnect(connection);
+        return result;
+    }
+
+    struct Typing
+    {
+        int         deliveries = 0;   // number of extensionsFetched() emissions
+        QStringList lastIds;          // ids of the last delivered results
+        qint64      elapsed = -1;     // time of the last delivery since first keystroke
+    };
+
+    // Types the word letter by letter and waits for the results of the whole word
+    Typing type(ExtensionFetcher &fetcher, const QUrl &url, const QString &word,
+                const QStringList &expected)
+    {
+        Typing typing;
+        QElapsedTimer timer;
+        QMetaObject::Connection connection =
+            QObject::connect(&fetcher, &ExtensionFetcher::extensionsFetched,
+                             [&](const QList<Extension> &extensions) {
+                typing.deliveries++;
+                typing.lastIds = ids(extensions);
+                typing.elapsed = timer.elapsed();
+            });
+
+        timer.start();
+        for (int i = 1; i <= word.length(); i++) {
+            fetcher.search(word.left(i), url);
+            if (i < word.length())
+                waitFor([&]() { return timer.elapsed() >= i * KEYSTROKE; });
+        }
+        waitFor([&]() { return typing.lastIds == expected && typing.elapsed >= 0; });
+        // let late replies arrive, they must not be delivered
+        QThread::msleep(LATENCY);
+        QCoreApplication::processEvents();
+
+        QObject::disconnect(connection);
+        return typing;
+    }
+
+    bool check(bool condition, const char *message)
+    {
+        std::printf("%s: %s\n", condition ? "OK    " : "FAILED", message);
+        return condition;
+    }
+
+    // ── Typing with an empty cache: superseded requests are aborted ──
+    bool testTypingColdCache(MockHttpServer &server, const QUrl &url, const QStringList &expected)
+    {
+        ExtensionFetcher fetcher;
+        int requests = server.requestCount();
+        Typing cold = type(fetcher, url, "mesh", expected);
+        std::printf("cold cache : %d requests issued, %d sent by fetcher, correct results after %lld ms\n",
+                    server.requestCount() - requests, fetcher.searchRequestCount(), cold.elapsed);
+
+        bool ok = check(cold.lastIds == expected, "cold cache: results of the last query are delivered");
+        ok &= check(cold.deliveries == 1, "cold cache: results of superseded queries are not delivered");
+        return ok;
+    }
+
+    // ── Typing after the whole catalogue is fetched: results are refined locally ──
+    bool testTypingWarmCache(const QUrl &url, const QStringList &expected)
+    {
+        ExtensionFetcher fetcher;
+        bool ok = check(!fetch(fetcher, url, "").isEmpty(), "warm cache: catalogue is fetched");
+
+        int sent = fetcher.searchRequestCount();
+        Typing warm = type(fetcher, url, "mesh", expected);
+        std::printf("warm cache : %d requests sent by fetcher, correct results after %lld ms\n",
+                    fetcher.searchRequestCount() - sent, warm.elapsed);
+
+        ok &= check(warm.lastIds == expected, "warm cache: refined results are correct");
+        ok &= check(fetcher.searchRequestCount() == sent, "warm cache: no request is sent");
+        return ok;
+    }
+
+    // ── Installation and uninstallation update the state of the cached results ──
+    bool testCacheInstalled(const QUrl &url, const QStringList &expected)
+    {
+        ExtensionFetcher fetcher;
+        QList<Extension> all = fetch(fetcher, url, "");
+        fetch(fetcher, url, "mesh");  // refined from the catalogue
+
+        Extension ext;
+        for (const Extension &item : all)
+            if (item.id == expected.first())
+                ext = item;
+        bool ok = check(!ext.id.isEmpty() && !ext.installed, "cache: extension is not installed");
+
+        auto isInstalled = [&](const QList<Extension> &extensions) {
+            for (const Extension &item : extensions)
+                if (item.id == ext.id)
+                    return item.installed;
+            return false;
+        };
+
+        bool finished = false, succeeded = false;
+        QObject::connect(&fetcher, &ExtensionFetcher::installFinished,
+                         [&](const QString &, bool result) { finished = true; succeeded = result; });
+        QObject::connect(&fetcher, &ExtensionFetcher::uninstallFinished,
+                         [&](const QString &, bool result) { finished = true; succeeded = result; });
+
+        fetcher.installExtension(ext, url);
+        ok &= check(waitFor([&]() { return finished; }) && succeeded, "cache: extension is installed");
+
+        int sent = fetcher.searchRequestCount();
+        ok &= check(isInstalled(fetch(fetcher, url, "")), "cache: catalogue shows installed extension");
+        ok &= check(isInstalled(fetch(fetcher, url, "mesh")), "cache: refined results show installed extension");
+
+        finished = succeeded = false;
+        fetcher.uninstallExtension(ext, url);
+        ok &= check(waitFor([&]() { return finished; }) && succeeded, "cache: extension is uninstalled");
+
+        ok &= check(!isInstalled(fetch(fetcher, url, "")), "cache: catalogue shows uninstalled extension");
+        ok &= check(!isInstalled(fetch(fetcher, url, "mesh")), "cache: refined results show uninstalled extension");
+        ok &= check(fetcher.searchRequestCount() == sent, "cache: no search request is sent after (un)installation");
+        return ok;
+    }
+
+    // ── Expired results are fetched again, together with the results refined from them ──
+    bool testCacheTimeToLive(const QUrl &url, const QStringList &expected)
+    {
+        ExtensionFetcher fetcher;
+        bool ok = check(fetcher.cacheTimeToLive() > 0, "time to live: cached results expire by default");
+        fetcher.setCacheTimeToLive(2 * LATENCY);
+
+        fetch(fetcher, url, "");
+        fetch(fetcher, url, "mesh");
+        ok &= check(fetcher.searchRequestCount() == 1, "time to live: fresh results are used");
+
+        QThread::msleep(3 * LATENCY);
+        ok &= check(ids(fetch(fetcher, url, "mesh")) == expected, "time to live: expired results are fetched again");
+        ok &= check(fetcher.searchRequestCount() == 2, "time to live: one request is sent for expired results");
+
+        // no limit
+        fetcher.setCacheTimeToLive(0);
+        QThread::msleep(3 * LATENCY);
+        fetch(fetcher, url, "mesh");
+        ok &= check(fetcher.searchRequestCount() == 2, "time to live: results without limit do not expire");
+        return ok;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+
+    MockHttpServer server;
+    int port = server.start(0);
+    if (port < 0) {
+        std::printf("FAILED: mock server can not be started\n");
+        return 1;
+    }
+    const QUrl url(QString("http://127.0.0.1:%1/extensions").arg(port));
+
+    // reference results, fetched without latency and without cache
+    QStringList expected;
+    {
+        ExtensionFetcher fetcher;
+        expected = ids(fetch(fetcher, url, "mesh"));
+    }
+    if (!check(!expected.isEmpty(), "reference results are fetched"))
+        return 1;
+    server.setLatency(LATENCY);
+
+    bool ok = testTypingColdCache(server, url, expected);
+    ok &= testTypingWarmCache(url, expected);
+    ok &= testCacheInstalled(url, expected);
+    ok &= testCacheTimeToLive(url, expected);
+
+    return ok ? 0 : 1;
+}
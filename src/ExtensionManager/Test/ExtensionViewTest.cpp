@@ -0,0 +1,156 @@
+// ─────────────────────────────────────────────────────────────
+// ExtensionViewTest
+//   Feeds ten thousand extensions to ExtensionModel and
+//   ExtensionDelegate and checks that:
+//     - a reordered list is merged with one layout change and
+//       persistent indexes follow their rows;
+//     - cached row layouts are rebuilt when the data changes.
+//   Prints the time of merging and of painting all rows with
+//   cold and warm caches.
+// ─────────────────────────────────────────────────────────────
+#include "ExtensionDelegate.h"
+#include "ExtensionModel.h"
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QPainter>
+#include <QPersistentModelIndex>
+
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    const int ROWS = 10000;
+
+    // Extensions with ids ext<first>..ext<first+count-1>
+    QList<Extension> makeExtensions(int first, int count)
+    {
+        QList<Extension> result;
+        for (int i = first; i < first + count; i++) {
+            Extension ext;
+            ext.id          = QString("ext%1").arg(i);
+            ext.name        = QString("Extension %1").arg(i);
+            ext.version     = "1.0.0";
+            ext.author      = "SALOME";
+            ext.description = QString("Description of the extension number %1").arg(i);
+            ext.rating      = i % 5 + 0.5;
+            ext.installs    = i * 10;
+            result << ext;
+        }
+        return result;
+    }
+
+    bool check(bool condition, const char *message)
+    {
+        std::printf("%s: %s\n", condition ? "OK    " : "FAILED", message);
+        return condition;
+    }
+
+    // ── Merging of a reordered list into the model ──
+    bool testModelReorder()
+    {
+        ExtensionModel model;
+        model.setExtensions(makeExtensions(0, ROWS));
+        bool ok = check(model.rowCount() == ROWS, "model: rows are added");
+
+        int layouts = 0, moves = 0, resets = 0;
+        QObject::connect(&model, &QAbstractItemModel::layoutChanged, [&]() { layouts++; });
+        QObject::connect(&model, &QAbstractItemModel::rowsMoved, [&]() { moves++; });
+        QObject::connect(&model, &QAbstractItemModel::modelReset, [&]() { resets++; });
+
+        // reversed list, one row removed, one added, one modified
+        QList<Extension> list = makeExtensions(1, ROWS);
+        std::reverse(list.begin(), list.end());
+        list[1].installs++;
+        QPersistentModelIndex selected = model.index(100);
+        const QString selectedId = selected.data(ExtensionModel::IdRole).toString();
+
+        QElapsedTimer timer;
+        timer.start();
+        model.setExtensions(list);
+        qint64 reorderTime = timer.restart();
+
+        bool sameOrder = model.rowCount() == ROWS;
+        for (int i = 0; sameOrder && i < ROWS; i++)
+            sameOrder = model.extensionAt(i).id == list[i].id;
+        ok &= check(sameOrder, "model: rows follow the new order");
+        ok &= check(model.index(1).data(ExtensionModel::InstallsRole).toInt() == list[1].installs,
+                    "model: modified row is updated");
+        ok &= check(layouts == 1 && moves == 0 && resets == 0, "model: rows are reordered in one layout change");
+
+        // persistent indexes (selection, current item) follow their rows
+        ok &= check(selected.isValid() && selected.data(ExtensionModel::IdRole).toString() == selectedId &&
+                    selected.row() == ROWS - 100, "model: persistent index follows its row");
+
+        // same order: no layout change
+        timer.restart();
+        model.setExtensions(list);
+        qint64 sameTime = timer.elapsed();
+        ok &= check(layouts == 1, "model: same list does not change the layout");
+
+        std::printf("ExtensionModel with %d rows: reorder %lld ms, same list %lld ms\n",
+                    ROWS, reorderTime, sameTime);
+        return ok;
+    }
+
+    // ── Painting of the rows with cached layouts ──
+    bool testDelegatePaint()
+    {
+        ExtensionModel model;
+        model.setExtensions(makeExtensions(0, ROWS));
+        ExtensionDelegate delegate;
+
+        QImage image(600, 90, QImage::Format_ARGB32);
+        QStyleOptionViewItem option;
+        option.rect = image.rect();
+
+        auto paintAll = [&]() {
+            QElapsedTimer timer;
+            timer.start();
+            QPainter painter(&image);
+            for (int i = 0; i < ROWS; i++)
+                delegate.paint(&painter, option, model.index(i));
+            return timer.elapsed();
+        };
+
+        auto paintRow = [&](int row) {
+            image.fill(Qt::black);
+            QPainter painter(&image);
+            delegate.paint(&painter, option, model.index(row));
+            painter.end();
+            return image;
+        };
+
+        qint64 coldTime = paintAll();
+        qint64 warmTime = paintAll();
+
+        // changed install count is drawn, not the cached one
+        QImage before = paintRow(0);
+        QList<Extension> list = makeExtensions(0, ROWS);
+        list[0].installs = 123456;
+        model.setExtensions(list);
+        bool ok = check(paintRow(0) != before, "delegate: changed install count is drawn");
+        list[0].installs = 0;
+        model.setExtensions(list);
+        ok &= check(paintRow(0) == before, "delegate: restored install count is drawn");
+
+        std::printf("ExtensionDelegate with %d rows: paint %lld ms with cold cache, %lld ms with warm cache\n",
+                    ROWS, coldTime, warmTime);
+        return ok;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // tests are run without a display
+    if (qgetenv("QT_QPA_PLATFORM").isEmpty())
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+
+    bool ok = testModelReorder();
+    ok &= testDelegatePaint();
+
+    return ok ? 0 : 1;
+}
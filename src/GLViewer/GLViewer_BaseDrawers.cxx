@@ -45,7 +45,8 @@ GLfloat cos_table[SEGMENTS];
   Default constructor
 */
 GLViewer_MarkerDrawer::GLViewer_MarkerDrawer()
-: GLViewer_Drawer()
+: GLViewer_Drawer(),
+  myRedrawCount( 0 )
 {
     GLfloat angle = 0.0;
     for ( int i = 0; i < SEGMENTS; i++ )
@@ -71,106 +72,184 @@ GLViewer_MarkerDrawer::~GLViewer_MarkerDrawer()
 */
 void GLViewer_MarkerDrawer::create( float xScale, float yScale, bool onlyUpdate )
 {
-    QList<int>::Iterator it;
-    QList<int>::Iterator EndIt;
+    QList<int>::ConstIterator it;
+    QList<int>::ConstIterator EndIt;
     QList<GLViewer_Object*>::Iterator anObjectIt = myObjects.begin();
     QList<GLViewer_Object*>::Iterator anEndObjectIt = myObjects.end();
 
     myXScale = xScale;
     myYScale = yScale;
 
+    if( !onlyUpdate )
+        myRedrawCount++;
+
     QColor colorN, colorH, colorS;
 
     GLViewer_MarkerSet* aMarkerSet = NULL;
     GLViewer_AspectLine* anAspectLine = NULL;
 
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glEnableClientState( GL_COLOR_ARRAY );
+
     for( ; anObjectIt != anEndObjectIt; anObjectIt++ )
     {
         aMarkerSet = ( GLViewer_MarkerSet* )(*anObjectIt);
         anAspectLine = aMarkerSet->getAspectLine();
         anAspectLine->getLineColors( colorN, colorH, colorS );
 
-        float* aXCoord = aMarkerSet->getXCoord();
-        float* anYCoord = aMarkerSet->getYCoord();
-        float aRadius = aMarkerSet->getMarkerSize();
-
+        // lists are implicitly shared, so exporting them does not copy the numbers
         QList<int> aHNumbers, anUHNumbers, aSelNumbers, anUSelNumbers;
         aMarkerSet->exportNumbers( aHNumbers, anUHNumbers, aSelNumbers, anUSelNumbers );
 
+        MarkerCache& aCache = myCache[ aMarkerSet ];
+        aCache.myLastUse = myRedrawCount;
+        updateGeometry( aCache, aMarkerSet, anAspectLine->getLineType() );
+
+        // highlighting is shown only on update, selection takes precedence over normal state
+        int aNumber = aCache.myNumber;
+        QVector<char> aStates( aNumber, (char)StateNormal );
+        EndIt = aSelNumbers.constEnd();
+        for( it = aSelNumbers.constBegin(); it != EndIt; ++it )
+            if( *it >= 0 && *it < aNumber )
+                aStates[ *it ] = StateSelected;
         if( onlyUpdate )
         {
-            EndIt = anUHNumbers.end();
-            for( it = anUHNumbers.begin(); it != EndIt; ++it )
-            {
-                drawMarker( aXCoord[*it], anYCoord[*it], aRadius, colorN, anAspectLine );
-            }
-
-            EndIt = anUSelNumbers.end();
-            for( it = anUSelNumbers.begin(); it != EndIt; ++it )
-                drawMarker( aXCoord[*it], anYCoord[*it], aRadius, colorN, anAspectLine );
-
-            EndIt = aSelNumbers.end();
-            for( it = aSelNumbers.begin(); it != EndIt; ++it )
-                drawMarker( aXCoord[*it], anYCoord[*it], aRadius, colorS, anAspectLine );
-
-            EndIt = aHNumbers.end();
-            for( it = aHNumbers.begin(); it != EndIt; ++it )
-            {
-                drawMarker( aXCoord[*it], anYCoord[*it], aRadius, colorH, anAspectLine );
-            }
+            EndIt = aHNumbers.constEnd();
+            for( it = aHNumbers.constBegin(); it != EndIt; ++it )
+                if( *it >= 0 && *it < aNumber )
+                    aStates[ *it ] = StateHighlighted;
         }
-        else
-        {
-            int aNumber = aMarkerSet->getNumMarkers();
-            for( int i = 0; i < aNumber; i++ )
-                drawMarker( aXCoord[i], anYCoord[i], aRadius, colorN, anAspectLine );
 
-            EndIt = anUSelNumbers.end();
-            for( it = anUSelNumbers.begin(); it != EndIt; ++it )
-                drawMarker( aXCoord[*it], anYCoord[*it], aRadius, colorN, anAspectLine );
+        const QRgb aColors[3] = { colorN.rgb(), colorH.rgb(), colorS.rgb() };
+        updateColors( aCache, aStates, aColors );
 
-            EndIt = aSelNumbers.end();
-            for( it = aSelNumbers.begin(); it != EndIt; ++it )
-                drawMarker( aXCoord[*it], anYCoord[*it], aRadius, colorS, anAspectLine );
+        if( !aCache.myVertices.isEmpty() )
+        {
+            glLineWidth( anAspectLine->getLineWidth() );
+            glVertexPointer( 2, GL_FLOAT, 0, aCache.myVertices.constData() );
+            glColorPointer( 3, GL_UNSIGNED_BYTE, 0, aCache.myVertexColors.constData() );
+            glDrawArrays( GL_LINES, 0, aCache.myVertices.size() / 2 );
         }
+
         if( aMarkerSet->getGLText()->getText() != "" )
         {
-            //float aXPos = 0, anYPos = 0;
-            //aMarkerSet->getGLText()->getPosition( aXPos, anYPos );
-            //drawText( aMarkerSet->getGLText()->getText(), aXPos, anYPos, colorN, &aMarkerSet->getGLText()->getFont(), aMarkerSet->getGLText()->getSeparator() );
+            glDisableClientState( GL_COLOR_ARRAY );
+            glDisableClientState( GL_VERTEX_ARRAY );
             drawText( aMarkerSet );
+            glEnableClientState( GL_VERTEX_ARRAY );
+            glEnableClientState( GL_COLOR_ARRAY );
+        }
+    }
+
+    glDisableClientState( GL_COLOR_ARRAY );
+    glDisableClientState( GL_VERTEX_ARRAY );
+
+    // objects are not reported to drawers on removal: forget the marker sets
+    // which have not been drawn during the last full redraws
+    if( !onlyUpdate )
+    {
+        QHash<GLViewer_Object*, MarkerCache>::Iterator aCacheIt = myCache.begin();
+        while( aCacheIt != myCache.end() )
+        {
+            if( myRedrawCount - aCacheIt.value().myLastUse > 16 )
+                aCacheIt = myCache.erase( aCacheIt );
+            else
+                ++aCacheIt;
         }
     }
 }
 
-/*! Draws marker
-  \param theXCoord - X position
-  \param theYCoord - Y position
-  \param theRadius - radius
-  \param theColor - color
-  \param theAspectLine - line aspect
+/*! Rebuilds vertices of the markers if the marker set has been changed
+  since the previous drawing or if the view has been zoomed
+  \param theCache - geometry cache of marker set
+  \param theMarkerSet - marker set
+  \param theLineType - line type of marker set
 */
-void GLViewer_MarkerDrawer::drawMarker( float& theXCoord, float& theYCoord,
-                                     float& theRadius, QColor& theColor, GLViewer_AspectLine* theAspectLine )
+void GLViewer_MarkerDrawer::updateGeometry( MarkerCache& theCache, GLViewer_MarkerSet* theMarkerSet,
+                                            int theLineType )
 {
-    glColor3f( ( GLfloat )theColor.red() / 255, 
-               ( GLfloat )theColor.green() / 255, 
-               ( GLfloat )theColor.blue() / 255 );
+    int aNumber = theMarkerSet->getNumMarkers();
+    float aRadius = theMarkerSet->getMarkerSize();
+    const float* aXCoord = theMarkerSet->getXCoord();
+    const float* anYCoord = theMarkerSet->getYCoord();
+
+    bool isValid = theCache.myNumber == aNumber && theCache.myRadius == aRadius &&
+                   theCache.myXScale == myXScale && theCache.myYScale == myYScale &&
+                   theCache.myLineType == theLineType;
+    const GLfloat* aCoords = theCache.myCoords.constData();
+    for( int i = 0; isValid && i < aNumber; i++ )
+        isValid = aCoords[ 2 * i ] == aXCoord[ i ] && aCoords[ 2 * i + 1 ] == anYCoord[ i ];
+    if( isValid )
+        return;
+
+    theCache.myNumber = aNumber;
+    theCache.myRadius = aRadius;
+    theCache.myXScale = myXScale;
+    theCache.myYScale = myYScale;
+    theCache.myLineType = theLineType;
+
+    // closed markers ( line type 0 ) get the segment back to the first point
+    int aSegments = theLineType == 0 ? SEGMENTS : SEGMENTS - 1;
+    theCache.myVertexNumber = 2 * aSegments;
+
+    theCache.myCoords.resize( 2 * aNumber );
+    theCache.myVertices.resize( 2 * theCache.myVertexNumber * aNumber );
+    theCache.myVertexColors.resize( 3 * theCache.myVertexNumber * aNumber );
+    theCache.myStates.fill( -1, aNumber );
+
+    GLfloat* aCoord = theCache.myCoords.data();
+    GLfloat* aVertex = theCache.myVertices.data();
+    for( int i = 0; i < aNumber; i++ )
+    {
+        *aCoord++ = aXCoord[ i ];
+        *aCoord++ = anYCoord[ i ];
+        for( int j = 0; j < aSegments; j++ )
+        {
+            int aNext = ( j + 1 ) % SEGMENTS;
+            *aVertex++ = aXCoord[ i ] + cos_table[ j ] * aRadius / myXScale;
+            *aVertex++ = anYCoord[ i ] + sin_table[ j ] * aRadius / myYScale;
+            *aVertex++ = aXCoord[ i ] + cos_table[ aNext ] * aRadius / myXScale;
+            *aVertex++ = anYCoord[ i ] + sin_table[ aNext ] * aRadius / myYScale;
+        }
+    }
+}
 
-    glLineWidth( theAspectLine->getLineWidth() );
+/*! Rewrites vertex colors of the markers whose state has been changed
+  \param theCache - geometry cache of marker set
+  \param theStates - new state of each marker
+  \param theColors - colors of normal, highlighted and selected markers
+*/
+void GLViewer_MarkerDrawer::updateColors( MarkerCache& theCache, const QVector<char>& theStates,
+                                          const QRgb theColors[3] )
+{
+    if( theCache.myColors[ StateNormal ] != theColors[ StateNormal ] ||
+        theCache.myColors[ StateHighlighted ] != theColors[ StateHighlighted ] ||
+        theCache.myColors[ StateSelected ] != theColors[ StateSelected ] )
+    {
+        for( int i = 0; i < 3; i++ )
+            theCache.myColors[ i ] = theColors[ i ];
+        theCache.myStates.fill( -1 );
+    }
 
-    if ( theAspectLine->getLineType() == 0 )
-        glBegin( GL_LINE_LOOP );
-    else
-        glBegin( GL_LINE_STRIP);
+    char* aStates = theCache.myStates.data();
+    GLubyte* aColors = theCache.myVertexColors.data();
+    for( int i = 0, n = theStates.size(); i < n; i++ )
+    {
+        if( aStates[ i ] == theStates[ i ] )
+            continue;
+        aStates[ i ] = theStates[ i ];
 
-    for ( int i = 0; i < SEGMENTS; i++ )
-        glVertex2f( theXCoord + cos_table[i] * theRadius / myXScale,
-                    theYCoord + sin_table[i] * theRadius / myYScale );
-    glEnd();
+        QRgb aColor = theColors[ (int)theStates[ i ] ];
+        GLubyte* aColorIt = aColors + 3 * theCache.myVertexNumber * i;
+        for( int j = 0; j < theCache.myVertexNumber; j++ )
+        {
+            *aColorIt++ = (GLubyte)qRed( aColor );
+            *aColorIt++ = (GLubyte)qGreen( aColor );
+            *aColorIt++ = (GLubyte)qBlue( aColor );
+        }
+    }
 }
 
-
 /*!
   Default constructor
 */
@@ -231,24 +310,31 @@ void GLViewer_PolylineDrawer::create( float xScale, float yScale, bool onlyUpdat
         float* anYCoord = aPolyline->getYCoord();
         int aSize = aPolyline->getNumber();        
 
+        // pass the whole polyline in one call instead of a glVertex call per point
+        int aVertexNumber = aPolyline->isClosed() && aSize > 0 ? aSize + 1 : aSize;
+        myVertices.resize( 2 * aVertexNumber );
+        GLfloat* aVertex = myVertices.data();
+        for( int i = 0; i < aSize ; i++ )
+        {
+            *aVertex++ = aXCoord[ i ];
+            *aVertex++ = anYCoord[ i ];
+        }
+        if( aVertexNumber > aSize )
+        {
+            *aVertex++ = aXCoord[ 0 ];
+            *aVertex++ = anYCoord[ 0 ];
+        }
+
         glColor3f( ( GLfloat )color.red() / 255, 
                    ( GLfloat )color.green() / 255, 
                    ( GLfloat )color.blue() / 255 );
 
         glLineWidth( anAspect->getLineWidth() );
 
-        if ( anAspect->getLineType() == 0 )
-            glBegin( GL_LINE_LOOP );
-        else
-            glBegin( GL_LINE_STRIP);
-
-        for( int i = 0; i < aSize ; i++ )
-             glVertex2f( aXCoord[ i ], anYCoord[ i ] );        
- 
-        if( aPolyline->isClosed() )
-            glVertex2f( aXCoord[ 0 ], anYCoord[ 0 ] );
-
-        glEnd();       
+        glEnableClientState( GL_VERTEX_ARRAY );
+        glVertexPointer( 2, GL_FLOAT, 0, myVertices.constData() );
+        glDrawArrays( anAspect->getLineType() == 0 ? GL_LINE_LOOP : GL_LINE_STRIP, 0, aVertexNumber );
+        glDisableClientState( GL_VERTEX_ARRAY );
 
         if( aPolyline->getGLText()->getText() != "" )
         {
@@ -27,12 +27,15 @@
 #ifndef GLVIEWER_BASEDRAWERS_H
 #define GLVIEWER_BASEDRAWERS_H
 
-class QColor;
-
 #include "GLViewer.h"
 #include "GLViewer_Drawer.h"
 
+#include <QColor>
+#include <QHash>
+#include <QVector>
+
 class GLViewer_AspectLine;
+class GLViewer_MarkerSet;
 
 #ifdef WIN32
 #pragma warning( disable:4251 )
@@ -53,8 +56,42 @@ public:
   virtual void       create( float, float, bool );
   
 private:
-  //! Draws marker in point (x,y) of \param radius with \param color and \param aspect
-  void               drawMarker( float& x, float& y, float& radius, QColor& color, GLViewer_AspectLine* aspect );
+  //! Marker state, used as index in the color table of the cache
+  enum { StateNormal = 0, StateHighlighted, StateSelected };
+
+  /*!
+    \struct MarkerCache
+    Retained geometry of one marker set: all markers as GL_LINES vertex pairs
+    with per-vertex colors, drawn with a single glDrawArrays() call
+  */
+  struct MarkerCache
+  {
+    MarkerCache() : myNumber( -1 ), myRadius( 0 ), myXScale( 0 ), myYScale( 0 ),
+                    myLineType( -1 ), myVertexNumber( 0 ), myLastUse( 0 )
+    { myColors[0] = myColors[1] = myColors[2] = 0; }
+
+    GLint            myNumber;       //!< number of markers the vertices were built for
+    GLfloat          myRadius;       //!< marker size the vertices were built for
+    GLfloat          myXScale;       //!< X scale the vertices were built for
+    GLfloat          myYScale;       //!< Y scale the vertices were built for
+    int              myLineType;     //!< line type the vertices were built for
+    int              myVertexNumber; //!< number of vertices per marker
+    QRgb             myColors[3];    //!< normal, highlighted and selected colors
+    QVector<GLfloat> myCoords;       //!< marker centers the vertices were built for
+    QVector<GLfloat> myVertices;     //!< GL_LINES vertices of all markers
+    QVector<GLubyte> myVertexColors; //!< RGB color of each vertex
+    QVector<char>    myStates;       //!< current state of each marker
+    int              myLastUse;      //!< last full redraw the cache was used in
+  };
+
+  //! Rebuilds vertices of \param cache if the marker set geometry or the scale has changed
+  void               updateGeometry( MarkerCache& cache, GLViewer_MarkerSet* markers, int lineType );
+  //! Rewrites vertex colors of the markers whose state has changed
+  void               updateColors( MarkerCache& cache, const QVector<char>& states, const QRgb colors[3] );
+
+private:
+  QHash<GLViewer_Object*, MarkerCache> myCache;
+  int                myRedrawCount;
 };
 
 /*!
@@ -69,6 +106,10 @@ public:
   ~GLViewer_PolylineDrawer();
   //! Redefined method
   virtual void       create( float, float, bool );    
+
+private:
+  //! Interleaved vertices of the polyline being drawn, reused between objects
+  QVector<GLfloat>   myVertices;
 };
 
 /*!
@@ -325,6 +325,8 @@ void GLViewer_MarkerSet::compute()
   myRect->setTop( yb + myYGap ); 
   myRect->setRight( xb + myXGap );
   myRect->setBottom( ya - myYGap );
+
+  geometryChanged();
 }
 
 /*!
@@ -977,6 +979,8 @@ void GLViewer_Polyline::compute()
   myRect->setTop( yb + yGap ); 
   myRect->setRight( xb + xGap );
   myRect->setBottom( ya - yGap );
+
+  geometryChanged();
 }
 
 /*!
@@ -1527,6 +1531,8 @@ void GLViewer_TextObject::compute()
     myRect->setTop( yPos + myHeight  ); 
     myRect->setRight( xPos + myWidth );
     myRect->setBottom( yPos );
+
+    geometryChanged();
 }
 
 /*!
@@ -42,8 +42,16 @@
 
 #include <TColStd_SequenceOfInteger.hxx>
 
+#include <algorithm>
+#include <cmath>
+
 #define TOLERANCE  12
 
+//! Maximal number of spatial index cells along each direction
+#define INDEX_MAX_CELLS   512
+//! Objects covering more spatial index cells are not put in cells
+#define INDEX_LARGE_CELLS 16
+
 /*!
   Constructor
 */
@@ -62,6 +70,18 @@ GLViewer_Context::GLViewer_Context( GLViewer_Viewer2d* v ) :
   mySFlag = GL_TRUE;
 
   mySelCurIndex = 0;
+
+  myIsAnyHighlighted = false;
+
+  myXScale = 0;
+  myYScale = 0;
+
+  myIsIndexValid = false;
+  myIndexColumns = 0;
+  myIndexRows = 0;
+  myIndexLargeBuilt = 0;
+  myIndexCellWidth = 1;
+  myIndexCellHeight = 1;
 }
 
 /*!
@@ -105,17 +125,18 @@ int GLViewer_Context::MoveTo( int xi, int yi, bool byCircle )
     if( myActiveObjects.isEmpty() )
         return -1;
 
-    ObjList::iterator it = myActiveObjects.end();
-    ObjList::iterator itEnd = myActiveObjects.begin();
-    for( it--; ; --it )
+    // test only objects near the cursor, topmost first
+    QVector<int> aCandidates = indexCandidates( x, x, y, y );
+    for( int i = aCandidates.size() - 1; i >= 0; i-- )
     {
-        GLViewer_Object* object = *it;
+        GLViewer_Object* object = myActiveObjects[ aCandidates[ i ] ];
 
         GLViewer_Rect* rect = object->getUpdateRect();
         if( object->isSelectable() &&
             rect->contains( GLViewer_Pnt( x, y ) ) )
         {
             onObject = GL_TRUE;
+            myIsAnyHighlighted = true;
             object->highlight( x, y, myTolerance, GL_FALSE );
             isHigh = object->isHighlighted();
         }
@@ -127,9 +148,6 @@ int GLViewer_Context::MoveTo( int xi, int yi, bool byCircle )
             lastPicked = object;
             break;
         }
-
-        if( it == itEnd )
-            break;
     }
 
     if( !myHFlag )
@@ -141,13 +159,17 @@ int GLViewer_Context::MoveTo( int xi, int yi, bool byCircle )
     if ( !onObject )
     {
         //cout << 0 << endl;
-        it = myActiveObjects.begin();
-        itEnd = myActiveObjects.end();
+        // objects are highlighted by this method only, nothing to do if it did not
+        if( myIsAnyHighlighted )
+        {
+            ObjList::iterator it = myActiveObjects.begin();
+            ObjList::iterator itEnd = myActiveObjects.end();
 
-        for( ; it != itEnd; ++it )
-            (*it)->unhighlight();
+            for( ; it != itEnd; ++it )
+                (*it)->unhighlight();
 
-        anUpdatedObjects.append( (*it) );
+            myIsAnyHighlighted = false;
+        }
 
         myLastPicked = 0;
         myLastPickedChanged = aPrevLastPicked != myLastPicked;
@@ -291,6 +313,7 @@ int GLViewer_Context::Select( bool Append, bool byCircle )
         GLfloat aYScale;
         GLViewer_ViewPort2d* vp = ( GLViewer_ViewPort2d* )myGLViewer2d->getActiveView()->getViewPort();
         vp->getScale( aXScale, aYScale );
+        applyScales( aXScale, aYScale );
 
         if ( !Append )
         {
@@ -314,7 +337,6 @@ int GLViewer_Context::Select( bool Append, bool byCircle )
 
         for( oit = myActiveObjects.begin(), oitEnd = myActiveObjects.end(); oit != oitEnd; ++oit )
         {
-            (*oit)->setScale( aXScale, aYScale );
             GLViewer_Rect* rect = (*oit)->getUpdateRect();
 
             if( rect->contains( GLViewer_Pnt( myXhigh, myXhigh ) ) )
@@ -370,23 +392,35 @@ int GLViewer_Context::SelectByRect( const QRect& theRect, bool Append )
         mySelectedObjects.clear();
     }
 
-    for( it = myActiveObjects.begin(), itEnd = myActiveObjects.end(); it != itEnd; ++it )
+    applyScales( aXScale, aYScale );
+
+    // test only objects which may intersect the rectangle ( widened by a pixel
+    // to stay on the safe side of rounding in window co-ordinates )
+    GLViewer_Rect aRect = myGLViewer2d->getGLVRect( theRect );
+    GLfloat aXTol = aXScale > 0 ? 1 / aXScale : 0;
+    GLfloat aYTol = aYScale > 0 ? 1 / aYScale : 0;
+    QVector<int> aCandidates =
+      indexCandidates( qMin( aRect.left(), aRect.right() ) - aXTol,
+                       qMax( aRect.left(), aRect.right() ) + aXTol,
+                       qMin( aRect.bottom(), aRect.top() ) - aYTol,
+                       qMax( aRect.bottom(), aRect.top() ) + aYTol );
+
+    for( int i = 0, n = aCandidates.size(); i < n; i++ )
     {
+        GLViewer_Object* object = myActiveObjects[ aCandidates[ i ] ];
         bool isSel = false;
-        (*it)->setScale( aXScale, aYScale );
-        QRect rect = myGLViewer2d->getQRect( *( (*it)->getRect() ) );
+        QRect rect = myGLViewer2d->getQRect( *( object->getRect() ) );
 
         if( rect.intersects( theRect ) )
         {
-            GLViewer_Rect aRect = myGLViewer2d->getGLVRect( theRect );
-            (*it)->select( myXhigh, myYhigh, myTolerance, aRect, false, false, Append );
-            isSel = (*it)->isSelected();
+            object->select( myXhigh, myYhigh, myTolerance, aRect, false, false, Append );
+            isSel = object->isSelected();
         }
 
-        if( isSel && mySelectedObjects.indexOf( *it ) == -1 )
+        if( isSel && mySelectedObjects.indexOf( object ) == -1 )
         {
-            aList.append( *it );
-            mySelectedObjects.append( *it );
+            aList.append( object );
+            mySelectedObjects.append( object );
             status = SS_GlobalChanged;
         }
     }
@@ -512,9 +546,12 @@ int GLViewer_Context::insertObject( GLViewer_Object* object, bool display, bool
     if( !object )
         return -1;
 
+    object->setContext( this );
+
     if( isActive )
     {
         myActiveObjects.append( object );
+        invalidateIndex();
         if( display )
         {
             //QRect* rect = object->getRect()->toQRect();
@@ -538,10 +575,14 @@ bool GLViewer_Context::replaceObject( GLViewer_Object* oldObject, GLViewer_Objec
     if( !oldObject || !newObject )
         return false;
 
+  oldObject->setContext( 0 );
+  newObject->setContext( this );
+
   if( myActiveObjects.contains( oldObject ) )
   {
     myActiveObjects.removeAll( oldObject );
     myActiveObjects.append( newObject );
+    invalidateIndex();
     return true;
   }
 
@@ -570,8 +611,222 @@ void GLViewer_Context::updateScales( GLfloat scX, GLfloat scY )
 
   for( it = myInactiveObjects.begin(), itEnd = myInactiveObjects.end(); it != itEnd; ++it )
       (*it)->setScale( scX, scY );
+
+  myXScale = scX;
+  myYScale = scY;
+  invalidateIndex();
+}
+
+/*!
+  Informs context that geometry of object has been changed
+  \param theObject - moved or recomputed object
+*/
+void GLViewer_Context::updateObject( GLViewer_Object* theObject )
+{
+  // the index is rebuilt on next use anyway
+  if( !myIsIndexValid || !theObject )
+    return;
+
+  // inactive objects are not indexed
+  QHash<GLViewer_Object*, int>::const_iterator anIt = myIndexPositions.constFind( theObject );
+  if( anIt == myIndexPositions.constEnd() )
+    return;
+
+  int anIndex = anIt.value();
+  const QRect& aCells = myIndexObjectCells[ anIndex ];
+  if( aCells.isValid() )
+  {
+    for( int aRow = aCells.top(); aRow <= aCells.bottom(); aRow++ )
+      for( int aCol = aCells.left(); aCol <= aCells.right(); aCol++ )
+        myIndexCells[ aRow * myIndexColumns + aCol ].removeOne( anIndex );
+  }
+  else
+    myIndexLarge.removeOne( anIndex );
+
+  GLViewer_Rect aRect;
+  binObject( anIndex, objectBounds( theObject, aRect ) ? &aRect : 0 );
+
+  // objects moved out of the grid are checked always,
+  // rebuild the grid when there are too many of them
+  if( myIndexLarge.count() > 2 * myIndexLargeBuilt + INDEX_LARGE_CELLS )
+    invalidateIndex();
+}
+
+/*!
+  Applies scales to all active objects if they have been changed since the last call
+  ( update rectangles of objects, and so the spatial index, depend on scales )
+*/
+void GLViewer_Context::applyScales( GLfloat theX, GLfloat theY )
+{
+  if( myIsIndexValid && theX == myXScale && theY == myYScale )
+      return;
+
+  ObjList::iterator it, itEnd;
+  for( it = myActiveObjects.begin(), itEnd = myActiveObjects.end(); it != itEnd; ++it )
+      (*it)->setScale( theX, theY );
+
+  myXScale = theX;
+  myYScale = theY;
+  invalidateIndex();
 }
 
+/*!
+  Rebuilds spatial index of active objects if it is out of date
+*/
+void GLViewer_Context::updateIndex()
+{
+  if( myIsIndexValid )
+    return;
+
+  myIsIndexValid = true;
+  myIndexCells.clear();
+  myIndexLarge.clear();
+  myIndexPositions.clear();
+  myIndexObjectCells.clear();
+  myIndexColumns = myIndexRows = 0;
+  myIndexLargeBuilt = 0;
+
+  int aNumber = myActiveObjects.count();
+  if( aNumber == 0 )
+    return;
+
+  QVector<GLViewer_Rect> aRects( aNumber );
+  QVector<bool> anIsValid( aNumber, false );
+  bool anIsFirst = true;
+  GLfloat aMinX = 0, aMaxX = 0, aMinY = 0, aMaxY = 0;
+  for( int i = 0; i < aNumber; i++ )
+  {
+    GLViewer_Object* anObject = myActiveObjects[ i ];
+    myIndexPositions.insert( anObject, i );
+
+    if( !( anIsValid[ i ] = objectBounds( anObject, aRects[ i ] ) ) )
+      continue;
+
+    const GLViewer_Rect& aRect = aRects[ i ];
+    if( anIsFirst )
+    {
+      anIsFirst = false;
+      aMinX = aRect.left(); aMaxX = aRect.right();
+      aMinY = aRect.bottom(); aMaxY = aRect.top();
+    }
+    else
+    {
+      aMinX = qMin( aMinX, aRect.left() ); aMaxX = qMax( aMaxX, aRect.right() );
+      aMinY = qMin( aMinY, aRect.bottom() ); aMaxY = qMax( aMaxY, aRect.top() );
+    }
+  }
+
+  myIndexObjectCells.fill( QRect(), aNumber );
+  if( !anIsFirst )
+  {
+    int aSize = qBound( 1, (int)std::sqrt( (double)aNumber ), INDEX_MAX_CELLS );
+    myIndexBounds = GLViewer_Rect( aMinX, aMaxX, aMaxY, aMinY );
+    myIndexColumns = aMaxX > aMinX ? aSize : 1;
+    myIndexRows = aMaxY > aMinY ? aSize : 1;
+    myIndexCellWidth = aMaxX > aMinX ? ( aMaxX - aMinX ) / myIndexColumns : 1;
+    myIndexCellHeight = aMaxY > aMinY ? ( aMaxY - aMinY ) / myIndexRows : 1;
+    myIndexCells.resize( myIndexColumns * myIndexRows );
+  }
+
+  for( int i = 0; i < aNumber; i++ )
+    binObject( i, anIsValid[ i ] ? &aRects[ i ] : 0 );
+
+  myIndexLargeBuilt = myIndexLarge.count();
+}
+
+/*!
+  Computes area of object used by spatial index: union of its rectangle and its update rectangle
+  \param theObject - object
+  \param theRect - area in global co-ordinates
+  \return false if area is degenerated ( e.g. zero scale )
+*/
+bool GLViewer_Context::objectBounds( GLViewer_Object* theObject, GLViewer_Rect& theRect ) const
+{
+  GLViewer_Rect* aRect = theObject->getRect();
+  GLViewer_Rect* anUpdateRect = theObject->getUpdateRect();
+
+  GLfloat aLeft = qMin( qMin( aRect->left(), aRect->right() ),
+                        qMin( anUpdateRect->left(), anUpdateRect->right() ) );
+  GLfloat aRight = qMax( qMax( aRect->left(), aRect->right() ),
+                         qMax( anUpdateRect->left(), anUpdateRect->right() ) );
+  GLfloat aBottom = qMin( qMin( aRect->bottom(), aRect->top() ),
+                          qMin( anUpdateRect->bottom(), anUpdateRect->top() ) );
+  GLfloat aTop = qMax( qMax( aRect->bottom(), aRect->top() ),
+                       qMax( anUpdateRect->bottom(), anUpdateRect->top() ) );
+  delete anUpdateRect;
+
+  theRect = GLViewer_Rect( aLeft, aRight, aTop, aBottom );
+  return std::isfinite( aLeft ) && std::isfinite( aRight ) &&
+         std::isfinite( aBottom ) && std::isfinite( aTop );
+}
+
+/*!
+  Puts object to cells of spatial index covered by its area
+  \param theIndex - position of object in active objects list
+  \param theRect - area of object, 0 if it is degenerated
+  Objects with degenerated area, covering many cells or lying out of the grid are checked always
+*/
+void GLViewer_Context::binObject( int theIndex, const GLViewer_Rect* theRect )
+{
+  myIndexObjectCells[ theIndex ] = QRect();
+
+  if( !theRect || myIndexCells.isEmpty() ||
+      theRect->left() < myIndexBounds.left() || theRect->right() > myIndexBounds.right() ||
+      theRect->bottom() < myIndexBounds.bottom() || theRect->top() > myIndexBounds.top() )
+  {
+    myIndexLarge.append( theIndex );
+    return;
+  }
+
+  GLfloat aMinX = myIndexBounds.left(), aMinY = myIndexBounds.bottom();
+  int aCol1 = qBound( 0, (int)( ( theRect->left() - aMinX ) / myIndexCellWidth ), myIndexColumns - 1 );
+  int aCol2 = qBound( 0, (int)( ( theRect->right() - aMinX ) / myIndexCellWidth ), myIndexColumns - 1 );
+  int aRow1 = qBound( 0, (int)( ( theRect->bottom() - aMinY ) / myIndexCellHeight ), myIndexRows - 1 );
+  int aRow2 = qBound( 0, (int)( ( theRect->top() - aMinY ) / myIndexCellHeight ), myIndexRows - 1 );
+
+  if( ( aCol2 - aCol1 + 1 ) * ( aRow2 - aRow1 + 1 ) > INDEX_LARGE_CELLS )
+  {
+    myIndexLarge.append( theIndex );
+    return;
+  }
+
+  for( int aRow = aRow1; aRow <= aRow2; aRow++ )
+    for( int aCol = aCol1; aCol <= aCol2; aCol++ )
+      myIndexCells[ aRow * myIndexColumns + aCol ].append( theIndex );
+  myIndexObjectCells[ theIndex ] = QRect( QPoint( aCol1, aRow1 ), QPoint( aCol2, aRow2 ) );
+}
+
+/*!
+  \return sorted positions in active objects list of objects which rectangles may intersect given area
+  \param theLeft, theRight, theBottom, theTop - area in global co-ordinates
+*/
+QVector<int> GLViewer_Context::indexCandidates( GLfloat theLeft, GLfloat theRight,
+                                                GLfloat theBottom, GLfloat theTop )
+{
+  updateIndex();
+
+  QVector<int> aResult = myIndexLarge;
+  if( !myIndexCells.isEmpty() &&
+      theRight >= myIndexBounds.left() && theLeft <= myIndexBounds.right() &&
+      theTop >= myIndexBounds.bottom() && theBottom <= myIndexBounds.top() )
+  {
+    GLfloat aMinX = myIndexBounds.left(), aMinY = myIndexBounds.bottom();
+    int aCol1 = qBound( 0, (int)( ( theLeft - aMinX ) / myIndexCellWidth ), myIndexColumns - 1 );
+    int aCol2 = qBound( 0, (int)( ( theRight - aMinX ) / myIndexCellWidth ), myIndexColumns - 1 );
+    int aRow1 = qBound( 0, (int)( ( theBottom - aMinY ) / myIndexCellHeight ), myIndexRows - 1 );
+    int aRow2 = qBound( 0, (int)( ( theTop - aMinY ) / myIndexCellHeight ), myIndexRows - 1 );
+
+    for( int aRow = aRow1; aRow <= aRow2; aRow++ )
+      for( int aCol = aCol1; aCol <= aCol2; aCol++ )
+        aResult += myIndexCells[ aRow * myIndexColumns + aCol ];
+  }
+
+  std::sort( aResult.begin(), aResult.end() );
+  aResult.erase( std::unique( aResult.begin(), aResult.end() ), aResult.end() );
+  return aResult;
+}
+
+
 /*!
   Clears hilighting of objects
   \param updateViewer - if it is true, viewer must be updated
@@ -674,7 +929,10 @@ void GLViewer_Context::deleteObject( GLViewer_Object* theObject, bool updateView
         return;
 
     if( myActiveObjects.contains( theObject ) )      
+    {
         myActiveObjects.removeAll( theObject );
+        invalidateIndex();
+    }
     else if( myInactiveObjects.contains( theObject ) )
         myInactiveObjects.removeAll( theObject );
     else 
@@ -690,6 +948,8 @@ void GLViewer_Context::deleteObject( GLViewer_Object* theObject, bool updateView
     if( myLastPicked == theObject )
         myLastPicked = 0;
 
+    theObject->setContext( 0 );
+
     if ( updateViewer )
       myGLViewer2d->updateAll();
 }
@@ -705,6 +965,7 @@ bool GLViewer_Context::setActive( GLViewer_Object* theObject )
 
   myInactiveObjects.removeAll( theObject );
   myActiveObjects.append( theObject );
+  invalidateIndex();
   return true;
 }
 
@@ -719,5 +980,6 @@ bool GLViewer_Context::setInactive( GLViewer_Object* theObject )
 
   myActiveObjects.removeAll( theObject );
   myInactiveObjects.append( theObject );
+  invalidateIndex();
   return true;
 }
@@ -34,7 +34,9 @@
 #include "GLViewer_Defs.h"
 #include "GLViewer_Object.h"
 
-class QRect;
+#include <QHash>
+#include <QRect>
+#include <QVector>
 
 #include <Quantity_NameOfColor.hxx>
 #include <Quantity_Color.hxx>
@@ -124,6 +126,12 @@ public:
   bool                  replaceObject( GLViewer_Object* oldObject, GLViewer_Object* newObject );
   //! A function updating scales of all objects in context
   void                  updateScales( GLfloat theX, GLfloat theY );
+  //! Informs context that geometry of object has been changed ( moved, recomputed )
+  /*!
+  * The object is moved to the cells of the spatial index of active objects
+  * used by MoveTo and SelectByRect, called by GLViewer_Object::compute()
+  */
+  void                  updateObject( GLViewer_Object* theObject );
   //! A function installing tolerance in window pixels for highlghting and selection methods
   void                  setTolerance( int tol ) { myTolerance = tol; }
 
@@ -161,6 +169,21 @@ public:
   //! A function installing to theObject inactive status
   bool                  setInactive( GLViewer_Object* theObject );
 
+protected:
+  //! Marks spatial index of active objects as out of date
+  void                  invalidateIndex() { myIsIndexValid = false; }
+  //! Rebuilds spatial index of active objects if it is out of date
+  void                  updateIndex();
+  //! Computes area of object used by spatial index, returns false if it is degenerated
+  bool                  objectBounds( GLViewer_Object* theObject, GLViewer_Rect& theRect ) const;
+  //! Puts object to cells of spatial index covered by its area
+  void                  binObject( int theIndex, const GLViewer_Rect* theRect );
+  //! Applies scales to all objects if they differ from the last applied ones
+  void                  applyScales( GLfloat theX, GLfloat theY );
+  //! Returns sorted positions in active objects list of objects which rectangles may intersect given area
+  QVector<int>          indexCandidates( GLfloat theLeft, GLfloat theRight,
+                                         GLfloat theBottom, GLfloat theTop );
+
 protected:
   //! Flag of updating viewer after highlight
   /*!
@@ -202,6 +225,33 @@ protected:
   GLboolean             mySFlag;
   //! Tolerance in window pixels for highlghting and selection methods
   int                   myTolerance;
+  //! = true if MoveTo has highlighted an object since the last unhighlighting of all objects
+  bool                  myIsAnyHighlighted;
+
+  //! Scales applied to all objects by the last selection
+  GLfloat               myXScale;
+  GLfloat               myYScale;
+
+  //! = false if spatial index must be rebuilt before use
+  bool                  myIsIndexValid;
+  //! Uniform grid over update rectangles of active objects
+  /*!
+  * Each cell contains positions of objects in active objects list,
+  * objects covering many cells are kept apart and checked always
+  */
+  QVector< QVector<int> > myIndexCells;
+  QVector<int>          myIndexLarge;
+  //! Number of objects checked always just after rebuilding of spatial index
+  int                   myIndexLargeBuilt;
+  //! Positions of objects in active objects list
+  QHash<GLViewer_Object*, int> myIndexPositions;
+  //! Ranges of cells ( columns and rows ) covered by objects, invalid for objects checked always
+  QVector<QRect>        myIndexObjectCells;
+  GLViewer_Rect         myIndexBounds;
+  int                   myIndexColumns;
+  int                   myIndexRows;
+  GLfloat               myIndexCellWidth;
+  GLfloat               myIndexCellHeight;
 };
 
 #ifdef WIN32
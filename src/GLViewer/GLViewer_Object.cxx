@@ -25,6 +25,7 @@
 #include "GLViewer_AspectLine.h"
 #include "GLViewer_Text.h"
 #include "GLViewer_Group.h"
+#include "GLViewer_Context.h"
 
 #include <SUIT_DataOwner.h>
 
@@ -57,6 +58,7 @@ GLViewer_Object::GLViewer_Object()
   isToolTipHTML = false;  
 
   myGroup = NULL;
+  myContext = NULL;
 }
 
 /*!
@@ -331,3 +333,13 @@ GLViewer_Group* GLViewer_Object::getGroup() const
 {
   return myGroup;
 }
+
+/*!
+  Informs context that object rect has been changed,
+  so that object is found at its new place by highlighting and selection
+*/
+void GLViewer_Object::geometryChanged()
+{
+  if( myContext )
+    myContext->updateObject( this );
+}
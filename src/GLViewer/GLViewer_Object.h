@@ -52,6 +52,7 @@ class GLViewer_Drawer;
 class GLViewer_AspectLine;
 class GLViewer_Group;
 class GLViewer_CoordSystem;
+class GLViewer_Context;
 class GLViewer_Text;
 //class GLViewer_Owner;
 
@@ -131,7 +132,7 @@ public:
                                 myRect->left(), myRect->right(), myRect->top(), myRect->bottom() ); }
   
   //! Installs object rectangle
-  virtual void              setRect( GLViewer_Rect* rect) { myRect = rect; }
+  virtual void              setRect( GLViewer_Rect* rect) { myRect = rect; geometryChanged(); }
   //! Returns object rectungle
   virtual GLViewer_Rect*    getRect() const { return myRect; }
   //! Returns update object rectangle
@@ -246,6 +247,11 @@ public:
   void                      setGroup( GLViewer_Group* theGroup );
   //! Returns object group
   GLViewer_Group*           getGroup() const;
+
+  //! Sets context the object is inserted in ( called by context )
+  void                      setContext( GLViewer_Context* theContext ) { myContext = theContext; }
+  //! Returns context the object is inserted in
+  GLViewer_Context*         getContext() const { return myContext; }
   
   //!\warning It is for ouv
   virtual GLViewer_Object*  getOwner() { return this; }
@@ -255,6 +261,10 @@ public:
   //!\warning It is for ouv
   virtual bool              isScalable() { return true; }
   
+protected:
+  //! Informs context that object rect has been changed ( must be called by compute() )
+  void                      geometryChanged();
+
 protected:
   //! Object name
   QString                   myName;
@@ -306,6 +316,8 @@ protected:
 
   //! Object Group
   GLViewer_Group*           myGroup;
+  //! Context the object is inserted in
+  GLViewer_Context*         myContext;
 };
 
 #ifdef WIN32
@@ -0,0 +1,126 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "GLViewer_BaseObjects.h"
+#include "GLViewer_Context.h"
+#include "GLViewer_Viewer2d.h"
+
+namespace
+{
+  // Creates set of one marker at the given point
+  GLViewer_MarkerSet* CreateMarker( GLfloat theX, GLfloat theY )
+  {
+    GLViewer_MarkerSet* aMarker = new GLViewer_MarkerSet( 1, 5 );
+    aMarker->setXCoord( &theX, 1 );
+    aMarker->setYCoord( &theY, 1 );
+    return aMarker;
+  }
+}
+
+/*!
+  \class GLViewerTest: test suit
+*/
+class GLViewerTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( GLViewerTest );
+  CPPUNIT_TEST( testMoveTo );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void testMoveTo();
+};
+
+/*!
+  Check highlighting and measure time of mouse moves over the context
+  with ten thousand markers, over the markers and over the empty space.
+
+  The viewer has no view: window co-ordinates passed to MoveTo() are used
+  as scene co-ordinates and the viewer is not redrawn.
+*/
+void GLViewerTest::testMoveTo()
+{
+  const int aNbRows = 100;
+  const int aNbObjects = aNbRows * aNbRows;
+  const int aNbMoves = 10000;
+  const int aStep = 50;
+
+  GLViewer_Viewer2d* aViewer = new GLViewer_Viewer2d( "TestGLViewer" );
+  GLViewer_Context* aContext = aViewer->getGLContext();
+  CPPUNIT_ASSERT( aContext );
+
+  GuiTest_Timer aTimer( QString( "GLViewer_Context with %1 objects" ).arg( aNbObjects ) );
+
+  QList<GLViewer_Object*> anObjects;
+  for ( int i = 0; i < aNbObjects; i++ ) {
+    GLViewer_MarkerSet* aMarker = CreateMarker( ( i % aNbRows ) * aStep, ( i / aNbRows ) * aStep );
+    aContext->insertObject( aMarker );
+    aMarker->compute();
+    anObjects.append( aMarker );
+  }
+  aTimer.step( "insert" );
+
+  // first move builds the spatial index
+  CPPUNIT_ASSERT_EQUAL( 0, aContext->MoveTo( 0, 0 ) );
+  CPPUNIT_ASSERT( aContext->getCurrentObject() == anObjects.first() );
+  aTimer.step( "index" );
+
+  // move over the markers: each move highlights the marker under the cursor
+  for ( int i = 0; i < aNbMoves; i++ ) {
+    int anIndex = ( i * 7919 ) % aNbObjects;
+    aContext->MoveTo( ( anIndex % aNbRows ) * aStep, ( anIndex / aNbRows ) * aStep );
+    CPPUNIT_ASSERT( aContext->getCurrentObject() == anObjects[ anIndex ] );
+  }
+  aTimer.step( QString( "%1 moves over objects" ).arg( aNbMoves ) );
+
+  // move over the empty space between the markers
+  for ( int i = 0; i < aNbMoves; i++ ) {
+    int anIndex = ( i * 7919 ) % aNbObjects;
+    aContext->MoveTo( ( anIndex % aNbRows ) * aStep + aStep / 2, ( anIndex / aNbRows ) * aStep + aStep / 2 );
+    CPPUNIT_ASSERT( !aContext->getCurrentObject() );
+  }
+  aTimer.step( QString( "%1 moves over empty space" ).arg( aNbMoves ) );
+
+  // moved marker is found at its new place only
+  GLViewer_Object* aMoved = anObjects.first();
+  aMoved->moveObject( aStep / 2, aStep / 2, false );
+  aContext->MoveTo( aStep / 2, aStep / 2 );
+  CPPUNIT_ASSERT( aContext->getCurrentObject() == aMoved );
+  aContext->MoveTo( 0, 0 );
+  CPPUNIT_ASSERT( !aContext->getCurrentObject() );
+
+  // inactive marker is not highlighted
+  CPPUNIT_ASSERT( aContext->setInactive( aMoved ) );
+  aContext->MoveTo( aStep / 2, aStep / 2 );
+  CPPUNIT_ASSERT( !aContext->getCurrentObject() );
+
+  // markers are deleted by the context
+  delete aViewer;
+
+  aTimer.print();
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( GLViewerTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"
@@ -36,7 +36,9 @@
 #include <QScrollBar>
 #include <QPrinter>
 #include <QPainter>
+#include <QSet>
 
+#include <algorithm>
 #include <math.h>
 
 #define FOREGROUND_Z_VALUE -2
@@ -100,8 +102,13 @@ void GraphicsView_ViewPort::createCursors ()
   panCursor   = new QCursor( Qt::SizeAllCursor );
   panglCursor = new QCursor( Qt::CrossCursor );
 
-  SUIT_ResourceMgr* rmgr = SUIT_Session::session()->resourceMgr();
-  zoomCursor   = new QCursor( rmgr->loadPixmap( "GraphicsView", tr( "ICON_GV_CURSOR_ZOOM" ) ) );
+  // the view port can be created without an application (e.g. in tests)
+  SUIT_Session* aSession = SUIT_Session::session();
+  SUIT_ResourceMgr* rmgr = aSession ? aSession->resourceMgr() : 0;
+  if( rmgr )
+    zoomCursor = new QCursor( rmgr->loadPixmap( "GraphicsView", tr( "ICON_GV_CURSOR_ZOOM" ) ) );
+  else
+    zoomCursor = new QCursor( Qt::CrossCursor );
 
   sketchCursor = new QCursor( Qt::CrossCursor );
 }
@@ -126,6 +133,7 @@ void GraphicsView_ViewPort::destroyCursors()
 //=======================================================================
 GraphicsView_ViewPort::GraphicsView_ViewPort( QWidget* theParent )
 : QGraphicsView( theParent ),
+  myObjectCounter( 0 ),
   myInteractionFlags( 0 ),
   myViewLabel( 0 ),
   myViewLabelPosition( VLP_None ),
@@ -260,19 +268,21 @@ void GraphicsView_ViewPort::addItem( QGraphicsItem* theItem )
 {
   if( GraphicsView_Object* anObject = dynamic_cast<GraphicsView_Object*>( theItem ) )
   {
+    // the list is sorted by priority, insert the object after all objects with the same priority
     int aPriority = anObject->getPriority();
-    GraphicsView_ObjectList::iterator anIter, anIterEnd = myObjects.end();
-    for( anIter = myObjects.begin(); anIter != anIterEnd; anIter++ )
-    {
-      if( GraphicsView_Object* anObjectRef = *anIter )
-      {
-        if( anObjectRef->getPriority() > aPriority )
-          break;
-      }
-    }
+    GraphicsView_ObjectList::iterator anIter =
+      std::upper_bound( myObjects.begin(), myObjects.end(), aPriority,
+                        []( int thePriority, GraphicsView_Object* theObject )
+                        { return theObject && thePriority < theObject->getPriority(); } );
     myObjects.insert( anIter, anObject );
+    myObjectKeys.insert( anObject, qMakePair( aPriority, myObjectCounter++ ) );
     anObject->setViewTransform( transform() );
     anObject->addTo( this );
+
+    // objects, which are not added to the scene, can't be found under the cursor
+    // by the scene, so they are always checked for highlighting
+    if( anObject->scene() != myScene )
+      myNotInSceneObjects.append( anObject );
   }
   else
     myScene->addItem( theItem );
@@ -285,11 +295,9 @@ void GraphicsView_ViewPort::addItem( QGraphicsItem* theItem )
 //================================================================
 bool GraphicsView_ViewPort::isItemAdded( QGraphicsItem* theItem )
 {
-  if( dynamic_cast<GraphicsView_Object*>( theItem ) )
+  if( GraphicsView_Object* anObject = dynamic_cast<GraphicsView_Object*>( theItem ) )
   {
-    for( GraphicsView_ObjectList::iterator anIter = myObjects.begin(); anIter != myObjects.end(); anIter++ )
-      if( theItem == *anIter )
-        return true;
+    return myObjectKeys.contains( anObject );
   }
   else {
     for( int i = 0; i < myScene->items().size(); i++ )
@@ -309,8 +317,11 @@ void GraphicsView_ViewPort::removeItem( QGraphicsItem* theItem )
   {
     if( myHighlightedObject == anObject )
       myHighlightedObject = 0;
+    myHighlightCandidates.remove( anObject );
     mySelectedObjects.removeAll( anObject );
     myObjects.removeAll( anObject );
+    myObjectKeys.remove( anObject );
+    myNotInSceneObjects.removeAll( anObject );
     anObject->removeFrom( this );
   }
   else
@@ -321,8 +332,11 @@ void GraphicsView_ViewPort::removeItem( QGraphicsItem* theItem )
 void GraphicsView_ViewPort::clearItems()
 {
   myHighlightedObject = 0;
+  myHighlightCandidates.clear();
   mySelectedObjects.clear();
   myObjects.clear();
+  myObjectKeys.clear();
+  myNotInSceneObjects.clear();
   myScene->clear();
   onBoundingRectChanged();
 }
@@ -383,24 +397,19 @@ GraphicsView_ObjectList GraphicsView_ViewPort::getObjects( SortType theSortType
     return aList;
   }
 
-  if( theSortType == SortByZLevel ) // double loop, needs to be optimized
+  if( theSortType == SortByZLevel )
   {
+    // objects with the same z-value keep their order
     GraphicsView_ObjectList aList;
 
     GraphicsView_ObjectListIterator anIter( myObjects );
     while( anIter.hasNext() )
-    {
       if( GraphicsView_Object* anObject = anIter.next() )
-      {
-        double aZValue = anObject->zValue();
-        GraphicsView_ObjectList::iterator anIter1, anIter1End = aList.end();
-        for( anIter1 = aList.begin(); anIter1 != anIter1End; anIter1++ )
-          if( GraphicsView_Object* anObjectRef = *anIter1 )
-            if( anObjectRef->zValue() > aZValue )
-              break;
-        aList.insert( anIter1, anObject );
-      }
-    }
+        aList.append( anObject );
+
+    std::stable_sort( aList.begin(), aList.end(),
+                      []( GraphicsView_Object* theLeft, GraphicsView_Object* theRight )
+                      { return theLeft->zValue() < theRight->zValue(); } );
     return aList;
   }
 
@@ -1108,7 +1117,7 @@ void GraphicsView_ViewPort::highlight( double theX, double theY )
 
   QCursor aCursor;
 
-  GraphicsView_ObjectList aList = getObjects( SortByZLevel );
+  GraphicsView_ObjectList aList = getHighlightCandidates( theX, theY );
   GraphicsView_ObjectListIterator anIter( aList );
   anIter.toBack(); // objects with higher priority have to be checked earlier
   while( anIter.hasPrevious() )
@@ -1136,15 +1145,23 @@ void GraphicsView_ViewPort::highlight( double theX, double theY )
 
   if( !anIsOnObject )
   {
+    // only the current candidates and the objects left highlighted
+    // by the previous calls can be highlighted
     anIter = aList;
     while( anIter.hasNext() )
       if( GraphicsView_Object* anObject = anIter.next() )
         anObject->unhighlight();
 
+    QSetIterator<GraphicsView_Object*> aCandIter( myHighlightCandidates );
+    while( aCandIter.hasNext() )
+      aCandIter.next()->unhighlight();
+    myHighlightCandidates.clear();
+
     myHighlightedObject = 0;
     return;
   }
-  else if( !myHighlightedObject && anIsHighlighted )
+
+  if( !myHighlightedObject && anIsHighlighted )
   {
     myHighlightedObject = aHighlightedObject;
   }
@@ -1162,6 +1179,63 @@ void GraphicsView_ViewPort::highlight( double theX, double theY )
       myHighlightedObject = aHighlightedObject;
     }
   }
+
+  // remember the candidates, which stay highlighted, to unhighlight them
+  // when the cursor leaves them
+  anIter = aList;
+  while( anIter.hasNext() )
+    if( GraphicsView_Object* anObject = anIter.next() )
+      myHighlightCandidates.insert( anObject );
+
+  QMutableSetIterator<GraphicsView_Object*> aCandIter( myHighlightCandidates );
+  while( aCandIter.hasNext() )
+    if( !aCandIter.next()->isHighlighted() )
+      aCandIter.remove();
+}
+
+//================================================================
+// Function : getHighlightCandidates
+// Purpose  : Get objects, which can be highlighted at the given point,
+//            in the same order as getObjects( SortByZLevel ) returns
+//================================================================
+GraphicsView_ObjectList GraphicsView_ViewPort::getHighlightCandidates( double theX, double theY ) const
+{
+  // one pixel around the point in scene coordinates
+  double aScale = qMax( fabs( transform().m11() ), 1e-10 );
+  double aTolerance = 1.0 / aScale;
+  QRectF aRect( theX - aTolerance, theY - aTolerance, 2 * aTolerance, 2 * aTolerance );
+
+  GraphicsView_ObjectList aList = myNotInSceneObjects;
+  QSet<GraphicsView_Object*> aFound;
+
+  QList<QGraphicsItem*> anItems = myScene->items( aRect, Qt::IntersectsItemBoundingRect );
+  QListIterator<QGraphicsItem*> anIter( anItems );
+  while( anIter.hasNext() )
+  {
+    // an object can be found by one of its sub-items
+    for( QGraphicsItem* anItem = anIter.next(); anItem; anItem = anItem->parentItem() )
+    {
+      GraphicsView_Object* anObject = dynamic_cast<GraphicsView_Object*>( anItem );
+      if( anObject && myObjectKeys.contains( anObject ) )
+      {
+        if( !aFound.contains( anObject ) && !myNotInSceneObjects.contains( anObject ) )
+        {
+          aFound.insert( anObject );
+          aList.append( anObject );
+        }
+        break;
+      }
+    }
+  }
+
+  std::sort( aList.begin(), aList.end(),
+             [this]( GraphicsView_Object* theLeft, GraphicsView_Object* theRight )
+             {
+               if( theLeft->zValue() != theRight->zValue() )
+                 return theLeft->zValue() < theRight->zValue();
+               return myObjectKeys.value( theLeft ) < myObjectKeys.value( theRight );
+             } );
+  return aList;
 }
 
 //================================================================
@@ -1170,6 +1244,11 @@ void GraphicsView_ViewPort::highlight( double theX, double theY )
 //================================================================
 void GraphicsView_ViewPort::clearHighlighted()
 {
+  QSetIterator<GraphicsView_Object*> anIter( myHighlightCandidates );
+  while( anIter.hasNext() )
+    anIter.next()->unhighlight();
+  myHighlightCandidates.clear();
+
   if( myHighlightedObject )
   {
     myHighlightedObject->unhighlight();
@@ -25,7 +25,10 @@
 #include "GraphicsView_Defs.h"
 
 #include <QGraphicsView>
+#include <QHash>
 #include <QPainterPath>
+#include <QPair>
+#include <QSet>
 
 class QGridLayout;
 class QRubberBand;
@@ -175,6 +178,7 @@ public:
 
   // highlighting
   virtual void                     highlight( double theX, double theY );
+  GraphicsView_ObjectList          getHighlightCandidates( double theX, double theY ) const;
   void                             clearHighlighted();
 
   GraphicsView_Object*             getHighlightedObject() const { return myHighlightedObject; }
@@ -277,6 +281,9 @@ private:
   double                           mySceneGap;
   double                           myFitAllGap;
   GraphicsView_ObjectList          myObjects;
+  QHash<GraphicsView_Object*, QPair<int, int> > myObjectKeys; // priority and sequential number of added objects
+  GraphicsView_ObjectList          myNotInSceneObjects;
+  int                              myObjectCounter;
 
   // interaction flags
   InteractionFlags                 myInteractionFlags;
@@ -315,6 +322,7 @@ private:
 
   // highlighting
   GraphicsView_Object*             myHighlightedObject;
+  QSet<GraphicsView_Object*>       myHighlightCandidates; // checked objects, which stay highlighted
   double                           myHighlightX;
   double                           myHighlightY;
   bool                             myIsHighlighting;
@@ -0,0 +1,131 @@
+// Copyright (C) 2013-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "GraphicsView_Object.h"
+#include "GraphicsView_ViewPort.h"
+
+#include <QGraphicsRectItem>
+
+/*
+  Class       : TestObject
+  Description : Rectangle object used by the tests
+*/
+class TestObject : public GraphicsView_Object
+{
+public:
+  TestObject( const QRectF& theRect ) : myRect( theRect ) {}
+
+  virtual void compute()
+  {
+    addToGroup( new QGraphicsRectItem( myRect ) );
+  }
+
+private:
+  QRectF myRect;
+};
+
+/*!
+  \class GraphicsViewTest: test suit
+*/
+class GraphicsViewTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( GraphicsViewTest );
+  CPPUNIT_TEST( testHighlight );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void testHighlight();
+};
+
+/*!
+  Check highlighting and measure time of mouse moves over the view port
+  with ten thousand objects, over the objects and over the empty space
+*/
+void GraphicsViewTest::testHighlight()
+{
+  const int aNbRows = 100;
+  const int aNbObjects = aNbRows * aNbRows;
+  const int aNbMoves = 10000;
+  const double aSize = 10., aStep = 20.;
+
+  GraphicsView_ViewPort* aViewPort = new GraphicsView_ViewPort( 0 );
+
+  GuiTest_Timer aTimer( QString( "GraphicsView_ViewPort with %1 objects" ).arg( aNbObjects ) );
+
+  GraphicsView_ObjectList anObjects;
+  for ( int i = 0; i < aNbObjects; i++ ) {
+    TestObject* anObject = new TestObject( QRectF( ( i % aNbRows ) * aStep, ( i / aNbRows ) * aStep, aSize, aSize ) );
+    anObject->compute();
+    aViewPort->addItem( anObject );
+    anObjects.append( anObject );
+  }
+  aTimer.step( "add" );
+
+  // move over the objects: each move highlights the object under the cursor
+  for ( int i = 0; i < aNbMoves; i++ ) {
+    int anIndex = ( i * 7919 ) % aNbObjects;
+    aViewPort->highlight( ( anIndex % aNbRows ) * aStep + aSize / 2, ( anIndex / aNbRows ) * aStep + aSize / 2 );
+    CPPUNIT_ASSERT( aViewPort->getHighlightedObject() == anObjects[ anIndex ] );
+  }
+  aTimer.step( QString( "%1 moves over objects" ).arg( aNbMoves ) );
+
+  // move over the empty space between the objects
+  for ( int i = 0; i < aNbMoves; i++ ) {
+    int anIndex = ( i * 7919 ) % aNbObjects;
+    aViewPort->highlight( ( anIndex % aNbRows ) * aStep + aSize * 1.5, ( anIndex / aNbRows ) * aStep + aSize * 1.5 );
+    CPPUNIT_ASSERT( !aViewPort->getHighlightedObject() );
+  }
+  aTimer.step( QString( "%1 moves over empty space" ).arg( aNbMoves ) );
+
+  // nothing stays highlighted after the cursor left the objects
+  GraphicsView_ObjectListIterator anIter( anObjects );
+  while ( anIter.hasNext() )
+    CPPUNIT_ASSERT( !anIter.next()->isHighlighted() );
+
+  // the object on top is highlighted
+  TestObject* aTopObject = new TestObject( QRectF( 0, 0, aSize, aSize ) );
+  aTopObject->compute();
+  aViewPort->addItem( aTopObject );
+  aTopObject->setZValue( 1 );
+  aViewPort->highlight( aSize / 2, aSize / 2 );
+  CPPUNIT_ASSERT( aViewPort->getHighlightedObject() == aTopObject );
+  CPPUNIT_ASSERT( !anObjects.first()->isHighlighted() );
+
+  // removed object is not highlighted any more
+  aViewPort->removeItem( aTopObject );
+  delete aTopObject;
+  aViewPort->highlight( aSize / 2, aSize / 2 );
+  CPPUNIT_ASSERT( aViewPort->getHighlightedObject() == anObjects.first() );
+  aViewPort->clearHighlighted();
+  CPPUNIT_ASSERT( !anObjects.first()->isHighlighted() );
+
+  delete aViewPort;
+
+  aTimer.print();
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( GraphicsViewTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"
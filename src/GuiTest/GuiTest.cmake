@@ -0,0 +1,34 @@
+# Copyright (C) 2012-2026  CEA, EDF, OPEN CASCADE
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+# Common rules of the GUI unit tests (built with SALOME_BUILD_TESTS):
+# test sources include GuiTest.hxx from GUITEST_INCLUDE_DIR, test executables
+# are built, registered in CTest and installed by SALOME_GUI_ADD_TEST().
+
+SET(GUITEST_INCLUDE_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+# SALOME_GUI_ADD_TEST(name sources...)
+# Builds test executable 'name' from the given sources and links it to
+# ${_link_LIBRARIES}; the test is run by CTest and installed to ${SALOME_INSTALL_BINS}.
+MACRO(SALOME_GUI_ADD_TEST name)
+  ADD_EXECUTABLE(${name} ${ARGN})
+  TARGET_LINK_LIBRARIES(${name} ${_link_LIBRARIES})
+  ADD_TEST(NAME ${name} COMMAND ${name})
+  INSTALL(TARGETS ${name} DESTINATION ${SALOME_INSTALL_BINS})
+ENDMACRO(SALOME_GUI_ADD_TEST)
@@ -0,0 +1,98 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef GUITEST_HXX
+#define GUITEST_HXX
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QStringList>
+
+#include <cstdio>
+
+/*!
+  \class GuiTest_Fixture
+  \brief Base class of the fixtures of GUI unit tests.
+
+  The application object is created by the first test case and shared by
+  all test cases of the executable. Tests are run without a display, unless
+  a platform plugin is set by QT_QPA_PLATFORM environment variable.
+*/
+class GuiTest_Fixture : public CppUnit::TestFixture
+{
+public:
+  virtual void setUp()
+  {
+    static int argc = 1;
+    static char* argv[] = { (char*)"GuiTest", 0 };
+    if ( !QApplication::instance() ) {
+      if ( qgetenv( "QT_QPA_PLATFORM" ).isEmpty() )
+        qputenv( "QT_QPA_PLATFORM", "offscreen" );
+      new QApplication( argc, argv );
+    }
+  }
+
+  virtual void tearDown()
+  {
+  }
+};
+
+/*!
+  \class GuiTest_Timer
+  \brief Measures successive steps of a benchmark and prints them in one line:
+  "<title>: <step> <time> ms, ...".
+
+  Durations are at least one millisecond, so that they can be used for
+  computing rates.
+*/
+class GuiTest_Timer
+{
+public:
+  GuiTest_Timer( const QString& theTitle ) : myTitle( theTitle ) { myTimer.start(); }
+
+  //! Start the next step, discarding time elapsed since the previous one
+  void   restart() { myTimer.restart(); }
+
+  //! Finish the current step and report its duration in milliseconds
+  qint64 step( const QString& theName )
+  {
+    qint64 aTime = qMax( myTimer.restart(), (qint64)1 );
+    myReport << QString( "%1 %2 ms" ).arg( theName ).arg( aTime );
+    return aTime;
+  }
+
+  //! Report a value which is not a duration of a step
+  void   note( const QString& theText ) { myReport << theText; }
+
+  //! Print the report to standard output
+  void   print() const
+  {
+    printf( "%s: %s\n", myTitle.toUtf8().constData(), myReport.join( ", " ).toUtf8().constData() );
+    fflush( stdout );
+  }
+
+private:
+  QString       myTitle;
+  QStringList   myReport;
+  QElapsedTimer myTimer;
+};
+
+#endif // GUITEST_HXX
@@ -83,6 +83,7 @@
 #include <SUIT_Tools.h>
 #include <SUIT_Accel.h>
 #include <SUIT_MessageBox.h>
+#include <SUIT_Profiler.h>
 #include <SUIT_ViewWindow.h>
 
 #include <Qtx.h>
@@ -382,6 +383,8 @@ LightApp_Application::LightApp_Application()
 {
   Q_INIT_RESOURCE( LightApp );
 
+  SUIT_Profiler::begin( "desktop" );
+
   STD_TabDesktop* desk = new STD_TabDesktop();
   desk->setFullScreenAllowed(false);
   desk->setMinimizeAllowed(false);
@@ -407,6 +410,8 @@ LightApp_Application::LightApp_Application()
   // extra logo (salome-based application)
   desktop()->logoInsert( "_app_extra", aResMgr->loadPixmap( "LightApp", tr( "APP_EXTRA_LOGO" ), false ) );
 
+  SUIT_Profiler::end();
+
   clearViewManagers();
 
   mySelMgr = new LightApp_SelectionMgr( this );
@@ -512,6 +517,7 @@ void LightApp_Application::start()
 
   LightApp_EventFilter::Init();
 
+  SUIT_Profiler::Scope aScope( "new study" );
   onNewDoc();
 }
 
@@ -2613,12 +2619,14 @@ QWidget* LightApp_Application::createWindow( const int flag )
 #ifndef DISABLE_PYCONSOLE
   else  if ( flag == WT_PyConsole )
   {
+    SUIT_Profiler::Scope aScope( "Python console" );
     PyConsole_Console* pyCons = new PyConsole_Console( desktop(), new LightApp_PyEditor( getPyInterp() ) );
     pyCons->setObjectName( "pythonConsole" );
     pyCons->setWindowTitle( tr( "PYTHON_CONSOLE" ) );
     pyCons->setFont( resMgr->fontValue( "PyConsole", "font" ) );
     pyCons->setIsShowBanner( resMgr->booleanValue( "PyConsole", "show_banner", true ) );
     pyCons->setAutoCompletion( resMgr->booleanValue( "PyConsole", "auto_completion", true ) );
+    pyCons->setMaxLines( resMgr->integerValue( "PyConsole", "max_lines", 0 ) );
     pyCons->setProperty( "shortcut", QKeySequence( "Alt+Shift+P" ) );
     wid = pyCons;
   }
@@ -2672,7 +2680,9 @@ LightApp_Preferences* LightApp_Application::preferences( const bool crt ) const
   bool toCreate = !_prefs_ && crt;
   if ( toCreate )
   {
+    SUIT_Profiler::Scope aScope( "preferences" );
     _prefs_ = new LightApp_Preferences( resourceMgr() );
+    _prefs_->setDeferred( true ); // widgets of pages are created when pages are shown
     that->createPreferences( _prefs_ );
     qAddPostRoutine( LightAppCleanUpAppResources );
   }
@@ -4423,6 +4433,9 @@ void LightApp_Application::preferencesChanged( const QString& sec, const QString
     else if ( param=="auto_completion" ) {
       pythonConsole()->setAutoCompletion( resMgr->booleanValue( "PyConsole", "auto_completion", true ) );
     }
+    else if ( param=="max_lines" ) {
+      pythonConsole()->setMaxLines( resMgr->integerValue( "PyConsole", "max_lines", 0 ) );
+    }
   }
 #endif
 
@@ -4758,6 +4771,8 @@ void LightApp_Application::currentViewManagers( QStringList& lst ) const
 */
 void LightApp_Application::updateWindows()
 {
+  SUIT_Profiler::Scope aScope( "dock windows" );
+
   QMap<int, int> winMap;
   currentWindows( winMap );
 
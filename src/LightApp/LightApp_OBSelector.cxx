@@ -28,11 +28,10 @@
 #include "LightApp_DataOwner.h"
 #include "LightApp_DataObject.h"
 #include "LightApp_Application.h"
+#include "LightApp_Study.h"
 #include <SUIT_DataBrowser.h>
 #include <SUIT_Session.h>
-#include <SUIT_DataObjectIterator.h>
 #include <QTime>
-#include <time.h>
 
 /*!
   \class LightApp_OBSelector
@@ -51,7 +50,6 @@ LightApp_OBSelector::LightApp_OBSelector( SUIT_DataBrowser* ob, SUIT_SelectionMg
   if ( myBrowser ) {
     connect( myBrowser, SIGNAL( selectionChanged() ), this, SLOT( onSelectionChanged() ) );
   }
-  setModified();
 }
 
 /*!
@@ -79,23 +77,6 @@ QString LightApp_OBSelector::type() const
   return "ObjectBrowser"; 
 }
 
-/*!
-  \brief Get the time of the last selection changing.
-  \return latest selection changing time
-*/
-unsigned long LightApp_OBSelector::getModifiedTime() const
-{
-  return myModifiedTime;
-}
-
-/*!
-  \brief Update the time of the latest selection changing.
-*/
-void LightApp_OBSelector::setModified()
-{
-  myModifiedTime = clock();
-}
-
 /*!
   \brief Called when the Object browser selection is changed.
 */
@@ -157,39 +138,23 @@ void LightApp_OBSelector::setSelection( const SUIT_DataOwnerPtrList& theList )
   if ( !myBrowser )
     return;
 
-  if( myEntries.count() == 0 || myModifiedTime < myBrowser->getModifiedTime() )
-    fillEntries( myEntries );
+  // data objects are looked up via the study's entry index, which
+  // is maintained incrementally: no need to traverse the whole tree
+  SUIT_Session* session = SUIT_Session::session();
+  SUIT_Application* sapp = session ? session->activeApplication() : 0;
+  LightApp_Study* study = sapp ? dynamic_cast<LightApp_Study*>( sapp->activeStudy() ) : 0;
 
   DataObjectList objList;
   for ( SUIT_DataOwnerPtrList::const_iterator it = theList.begin(); 
-        it != theList.end(); ++it ) {
+        study && it != theList.end(); ++it ) {
     const LightApp_DataOwner* owner = dynamic_cast<const LightApp_DataOwner*>( (*it).operator->() );
-    if ( owner && myEntries.contains( owner->entry() ) )
-      objList.append( myEntries[owner->entry()] );
+    if ( !owner )
+      continue;
+    LightApp_DataObject* obj = study->findObjectByEntry( owner->entry() );
+    if ( obj && obj->root() == myBrowser->root() )
+      objList.append( obj );
   }
 
   myBrowser->setSelected( objList );
   mySelectedList.clear();
 }
-
-/*!
-  \brief Fill map of the data objects currently shown in the Object Browser.
-  \param entries map to be filled
-*/
-void LightApp_OBSelector::fillEntries( QMap<QString, LightApp_DataObject*>& entries )
-{
-  entries.clear();
-
-  if ( !myBrowser )
-    return;
-
-  for ( SUIT_DataObjectIterator it( myBrowser->root(),
-                                    SUIT_DataObjectIterator::DepthLeft ); it.current(); ++it ) {
-    LightApp_DataObject* obj = dynamic_cast<LightApp_DataObject*>( it.current() );
-    if ( obj )
-      entries.insert( obj->entry(), obj );
-  }
-
-  setModified();
-}
-
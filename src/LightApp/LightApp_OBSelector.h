@@ -48,9 +48,6 @@ public:
 
   virtual QString    type() const;
 
-  unsigned long      getModifiedTime() const;
-  void               setModified();
-
 private slots:
   void               onSelectionChanged();
 
@@ -58,14 +55,9 @@ protected:
   virtual void       getSelection( SUIT_DataOwnerPtrList& ) const;
   virtual void       setSelection( const SUIT_DataOwnerPtrList& );
 
-private:
-  void               fillEntries( QMap<QString, LightApp_DataObject*>& );
-
 private:
   SUIT_DataBrowser*                   myBrowser;
   SUIT_DataOwnerPtrList               mySelectedList;
-  QMap<QString, LightApp_DataObject*> myEntries;
-  unsigned long                       myModifiedTime;
 };
 
 #endif
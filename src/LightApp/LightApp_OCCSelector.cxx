@@ -25,10 +25,14 @@
 
 #ifndef DISABLE_SALOMEOBJECT
   #include <SALOME_InteractiveObject.hxx>
+  #include <SALOME_ListIO.hxx>
+  #include <SOCC_ViewModel.h>
 #endif
 #include <AIS_ListOfInteractive.hxx>
 #include <AIS_ListIteratorOfListOfInteractive.hxx>
 
+#include <QSet>
+
 /*!
   Constructor
 */
@@ -116,6 +120,48 @@ void LightApp_OCCSelector::setSelection( const SUIT_DataOwnerPtrList& aList )
   if ( !myViewer )
     return;
 
+#ifndef DISABLE_SALOMEOBJECT
+  // SALOME viewer finds displayed objects by entry: all displayed objects are
+  // scanned at most once, the whole selection is highlighted at once, with a
+  // single viewer update
+  SOCC_Viewer* aSViewer = dynamic_cast<SOCC_Viewer*>( myViewer );
+  if ( aSViewer )
+  {
+    SALOME_ListIO aSelIO, aNotFoundIO;
+    QList<Handle(SALOME_InteractiveObject)> anOwnerIO;
+    for ( SUIT_DataOwnerPtrList::const_iterator itr = aList.begin(); itr != aList.end(); ++itr )
+    {
+      const LightApp_DataOwner* owner = dynamic_cast<const LightApp_DataOwner*>( (*itr).operator->() );
+      Handle(SALOME_InteractiveObject) anIO;
+      if ( owner )
+        anIO = !owner->IO().IsNull() ? owner->IO() :
+          new SALOME_InteractiveObject( owner->entry().toUtf8().constData(), "" );
+      if ( !anIO.IsNull() && anIO->hasEntry() )
+        aSelIO.Append( anIO );
+      anOwnerIO.append( anIO );
+    }
+
+    aSViewer->unHighlightAll( false );
+    aSViewer->highlight( aSelIO, true, false, &aNotFoundIO );
+
+    // owners which are not displayed in the viewer are kept as external ones
+    QSet<QString> aNotFound;
+    for ( SALOME_ListIteratorOfListIO it( aNotFoundIO ); it.More(); it.Next() )
+      aNotFound.insert( it.Value()->getEntry() );
+    mySelectedExternals.clear();
+    int anIndex = 0;
+    for ( SUIT_DataOwnerPtrList::const_iterator itr = aList.begin(); itr != aList.end(); ++itr, ++anIndex )
+    {
+      const Handle(SALOME_InteractiveObject)& anIO = anOwnerIO[anIndex];
+      if ( anIO.IsNull() || !anIO->hasEntry() || aNotFound.contains( anIO->getEntry() ) )
+        mySelectedExternals.append(*itr);
+    }
+
+    aSViewer->getAISContext()->UpdateCurrentViewer();
+    return;
+  }
+#endif
+
   QMap<QString, Handle(AIS_InteractiveObject)> aDisplayed;
   Handle(AIS_InteractiveContext) aContext = myViewer->getAISContext();
   if ( aContext.IsNull() )
@@ -42,11 +42,22 @@
   Constructor.
 */
 LightApp_Study::LightApp_Study( SUIT_Application* app )
-: CAM_Study( app )
+: CAM_Study( app ),
+  myEntryIndexValid( false )
 {
   // HDF persistence
   myDriver = new LightApp_HDFDriver();
   //myDriver = new LightApp_Driver();
+
+  // keep entry index up to date
+  SUIT_DataObject::connect( SIGNAL( inserted( SUIT_DataObject*, SUIT_DataObject* ) ),
+                            this, SLOT( onObjectInserted( SUIT_DataObject*, SUIT_DataObject* ) ) );
+  SUIT_DataObject::connect( SIGNAL( attached( SUIT_DataObject*, SUIT_DataObject* ) ),
+                            this, SLOT( onObjectInserted( SUIT_DataObject*, SUIT_DataObject* ) ) );
+  SUIT_DataObject::connect( SIGNAL( removed( SUIT_DataObject*, SUIT_DataObject* ) ),
+                            this, SLOT( onObjectRemoved( SUIT_DataObject*, SUIT_DataObject* ) ) );
+  SUIT_DataObject::connect( SIGNAL( destroyed( SUIT_DataObject* ) ),
+                            this, SLOT( onObjectDestroyed( SUIT_DataObject* ) ) );
 }
 
 /*!
@@ -54,6 +65,16 @@ LightApp_Study::LightApp_Study( SUIT_Application* app )
 */
 LightApp_Study::~LightApp_Study()
 {
+  // data tree is destroyed by base class: stop tracking it before
+  SUIT_DataObject::disconnect( SIGNAL( inserted( SUIT_DataObject*, SUIT_DataObject* ) ),
+                               this, SLOT( onObjectInserted( SUIT_DataObject*, SUIT_DataObject* ) ) );
+  SUIT_DataObject::disconnect( SIGNAL( attached( SUIT_DataObject*, SUIT_DataObject* ) ),
+                               this, SLOT( onObjectInserted( SUIT_DataObject*, SUIT_DataObject* ) ) );
+  SUIT_DataObject::disconnect( SIGNAL( removed( SUIT_DataObject*, SUIT_DataObject* ) ),
+                               this, SLOT( onObjectRemoved( SUIT_DataObject*, SUIT_DataObject* ) ) );
+  SUIT_DataObject::disconnect( SIGNAL( destroyed( SUIT_DataObject* ) ),
+                               this, SLOT( onObjectDestroyed( SUIT_DataObject* ) ) );
+
   delete myDriver; myDriver = 0;
 }
 
@@ -750,11 +771,145 @@ Qtx::VisibilityState LightApp_Study::visibilityState( const QString& theEntry )
 */
 LightApp_DataObject* LightApp_Study::findObjectByEntry( const QString& theEntry )
 {
-  LightApp_DataObject* aCurObj;
-  for ( SUIT_DataObjectIterator it( root(), SUIT_DataObjectIterator::DepthLeft ); it.current(); ++it ) {
-    aCurObj = dynamic_cast<LightApp_DataObject*>( it.current() );
+  updateEntryIndex();
+
+  // several objects can have the same entry: take any one still having it
+  QList<SUIT_DataObject*> anIndexed = myEntryIndex.values( theEntry );
+  foreach ( SUIT_DataObject* obj, anIndexed ) {
+    LightApp_DataObject* aCurObj = dynamic_cast<LightApp_DataObject*>( obj );
     if ( aCurObj && aCurObj->entry() == theEntry )
       return aCurObj;
+    // entry of the object has been changed since it was indexed: re-index it
+    unindexObject( obj );
+    indexObject( obj );
+  }
+  return 0;
+}
+
+/*!
+  Set root data object; entry index is rebuilt on next lookup.
+  \param obj new root object
+*/
+void LightApp_Study::setRoot( SUIT_DataObject* obj )
+{
+  CAM_Study::setRoot( obj );
+
+  myEntryIndex.clear();
+  myIndexedEntries.clear();
+  myPendingObjects.clear();
+  myEntryIndexValid = false;
+}
+
+/*!
+  Bring entry index up to date.
+
+  The index is built by the full data tree traversal only once (or after
+  the root object is changed); afterwards it is maintained incrementally:
+  the objects inserted to the tree are queued and indexed here, so that
+  only newly added sub-trees are visited.
+*/
+void LightApp_Study::updateEntryIndex()
+{
+  if ( !myEntryIndexValid ) {
+    myEntryIndex.clear();
+    myIndexedEntries.clear();
+    myPendingObjects.clear();
+    if ( root() )
+      indexObject( root() );
+    myEntryIndexValid = true;
+    return;
+  }
+
+  if ( myPendingObjects.isEmpty() )
+    return;
+
+  QSet<SUIT_DataObject*> pending = myPendingObjects;
+  myPendingObjects.clear();
+  foreach ( SUIT_DataObject* obj, pending ) {
+    // object could be detached from the tree after insertion
+    if ( obj && root() && obj->root() == root() )
+      indexObject( obj );
+  }
+}
+
+/*!
+  Add data object and all its children to the entry index.
+  \param obj data object
+*/
+void LightApp_Study::indexObject( SUIT_DataObject* obj )
+{
+  for ( SUIT_DataObjectIterator it( obj, SUIT_DataObjectIterator::DepthLeft ); it.current(); ++it ) {
+    LightApp_DataObject* aCurObj = dynamic_cast<LightApp_DataObject*>( it.current() );
+    if ( !aCurObj || myIndexedEntries.contains( it.current() ) )
+      continue;
+    QString anEntry = aCurObj->entry();
+    myIndexedEntries.insert( it.current(), anEntry );
+    myEntryIndex.insert( anEntry, it.current() );
+  }
+}
+
+/*!
+  Remove data object and all its children from the entry index.
+  \param obj data object
+*/
+void LightApp_Study::unindexObject( SUIT_DataObject* obj )
+{
+  DataObjectList objects;
+  objects.append( obj );
+  obj->SUIT_DataObject::children( objects, true );
+  foreach ( SUIT_DataObject* o, objects ) {
+    myPendingObjects.remove( o );
+    QHash<SUIT_DataObject*, QString>::iterator it = myIndexedEntries.find( o );
+    if ( it == myIndexedEntries.end() )
+      continue;
+    myEntryIndex.remove( it.value(), o );
+    myIndexedEntries.erase( it );
+  }
+}
+
+/*!
+  Called when data object is inserted to the data tree, with or without
+  notification of the tree model (see SUIT_DataObject::insertChildAtPos()).
+  The object is not indexed immediately: it can still be under construction.
+  \param obj data object being inserted
+  \param parent parent data object
+*/
+void LightApp_Study::onObjectInserted( SUIT_DataObject* obj, SUIT_DataObject* parent )
+{
+  if ( !myEntryIndexValid || !obj || !parent || !root() )
+    return;
+
+  if ( parent->root() == root() )
+    myPendingObjects.insert( obj );
+}
+
+/*!
+  Called when data object is removed from the data tree.
+  \param obj data object being removed
+  \param parent parent data object
+*/
+void LightApp_Study::onObjectRemoved( SUIT_DataObject* obj, SUIT_DataObject* /*parent*/ )
+{
+  if ( !myEntryIndexValid || !obj )
+    return;
+
+  if ( myIndexedEntries.contains( obj ) || myPendingObjects.contains( obj ) || obj->childCount() > 0 )
+    unindexObject( obj );
+}
+
+/*!
+  Called when data object is destroyed.
+  \param obj data object being destroyed
+*/
+void LightApp_Study::onObjectDestroyed( SUIT_DataObject* obj )
+{
+  if ( !myEntryIndexValid )
+    return;
+
+  myPendingObjects.remove( obj );
+  QHash<SUIT_DataObject*, QString>::iterator it = myIndexedEntries.find( obj );
+  if ( it != myIndexedEntries.end() ) {
+    myEntryIndex.remove( it.value(), obj );
+    myIndexedEntries.erase( it );
   }
-  return NULL;
 }
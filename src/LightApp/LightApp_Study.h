@@ -32,11 +32,14 @@
 #include "vector"
 #include <Qtx.h>
 
+#include <QHash>
 #include <QMap>
+#include <QSet>
 #include <QVariant>
 
 class SUIT_Study;
 class SUIT_Application;
+class SUIT_DataObject;
 class CAM_DataModel;
 class CAM_ModuleObject;
 class LightApp_DataObject;
@@ -132,6 +135,8 @@ protected:
   virtual CAM_ModuleObject* createModuleObject( LightApp_DataModel* theDataModel, 
                                                 SUIT_DataObject* theParent ) const;
 
+  virtual void        setRoot( SUIT_DataObject* );
+
 signals:
   void                saved  ( SUIT_Study* );
   void                opened ( SUIT_Study* );
@@ -140,11 +145,27 @@ signals:
 
   void                objVisibilityChanged( QString, Qtx::VisibilityState );
 
+private slots:
+  void                onObjectInserted( SUIT_DataObject*, SUIT_DataObject* );
+  void                onObjectRemoved( SUIT_DataObject*, SUIT_DataObject* );
+  void                onObjectDestroyed( SUIT_DataObject* );
+
+private:
+  void                updateEntryIndex();
+  void                indexObject( SUIT_DataObject* );
+  void                unindexObject( SUIT_DataObject* );
 
 private:
+  typedef QMultiHash<QString, SUIT_DataObject*> EntryIndex;
+
   LightApp_Driver*    myDriver;
   ViewMgrMap          myViewMgrMap;
 
+  EntryIndex                        myEntryIndex;      //!< entry -> data objects
+  QHash<SUIT_DataObject*, QString>  myIndexedEntries;  //!< data object -> indexed entry
+  QSet<SUIT_DataObject*>            myPendingObjects;  //!< inserted, not yet indexed
+  bool                              myEntryIndexValid;
+
   friend class LightApp_Application;
   friend class LightApp_DataModel;
 };
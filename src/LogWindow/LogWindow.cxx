@@ -31,9 +31,11 @@
 #include <QDate>
 #include <QFile>
 #include <QMenu>
-#include <QTextBlock>
-#include <QTextEdit>
+#include <QMutexLocker>
+#include <QPlainTextEdit>
+#include <QTextDocument>
 #include <QTextStream>
+#include <QThread>
 #include <QTime>
 #include <QVBoxLayout>
 
@@ -43,6 +45,7 @@
 #include <SUIT_Tools.h>
 
 #define DEFAULT_SEPARATOR "***"
+#define DEFAULT_MAX_LINES 50000
 
 namespace
 {
@@ -83,6 +86,11 @@ namespace
   - clear log output
   - copy messages to clipvoard
   - save message log to to the text file
+
+  Both the view and the messages history keep at most maxLines() lines,
+  the oldest lines being dropped first. The view only lays out the lines
+  which are visible, so the cost of adding a message does not depend on
+  the size of the log.
 */
 
 /*!
@@ -100,7 +108,7 @@ LogWindow::LogWindow( QWidget* parent )
 
   setFont( SUIT_Tools::stringToFont( fntSet ) );
 
-  myView = new QTextEdit( this );
+  myView = new QPlainTextEdit( this );
   myView->setReadOnly( true );
   myView->viewport()->installEventFilter( this );
   myView->setPlaceholderText( "Message Log" );
@@ -111,6 +119,8 @@ LogWindow::LogWindow( QWidget* parent )
 
   mySeparator = DEFAULT_SEPARATOR;
 
+  setMaxLines( resMgr ? resMgr->integerValue( "Log Window", "max_lines", DEFAULT_MAX_LINES ) : DEFAULT_MAX_LINES );
+
   clear();
 
   createActions();
@@ -230,13 +240,13 @@ void LogWindow::putMessage( const QString& message, const QColor& color, const i
     msg = QString( "[%1] %2" ).arg( dateTime ).arg( msg );
 
   append( msg );
-  myHistory.append( plainText( message ) );
+  addHistory( plainText( message ) );
 
   if ( flags & DisplaySeparator && !mySeparator.isEmpty() )
   {
     // add separator
     append( mySeparator );
-    myHistory.append( plainText( mySeparator ) );
+    addHistory( plainText( mySeparator ) );
   }
   myView->moveCursor( QTextCursor::End );
 }
@@ -249,15 +259,25 @@ void LogWindow::append( const QString text )
 {
   if ( !text.isEmpty() )
   {
-    myView->append( text );
-    QTextBlock block = myView->document()->lastBlock();
-    QTextCursor cursor( block );
-    QTextBlockFormat format = cursor.blockFormat();
-    format.setBottomMargin( 10 );
-    cursor.setBlockFormat( format );
+    if ( Qt::mightBeRichText( text ) )
+      myView->appendHtml( text );
+    else
+      myView->appendPlainText( text );
   }
 }
 
+/*!
+  \brief Append text to the messages history, dropping the oldest lines
+  if the history exceeds maximum number of lines.
+  \param text Text being added.
+*/
+void LogWindow::addHistory( const QString& text )
+{
+  myHistory.append( text );
+  while ( myMaxLines > 0 && myHistory.count() > myMaxLines )
+    myHistory.removeFirst();
+}
+
 /*!
   \brief Clear message log.
   \param clearHistory if True, clear also the messages history
@@ -280,6 +300,7 @@ bool LogWindow::saveLog( const QString& fileName )
   if ( !file.open( QFile::WriteOnly ) )
     return false;
 
+  // lines are written one by one, the stream being flushed to the file by its buffer
   QTextStream stream( &file );
 
   stream << "*****************************************"   << endl;
@@ -289,10 +310,39 @@ bool LogWindow::saveLog( const QString& fileName )
   stream << "*****************************************"   << endl;
 
   for ( int i = 0; i < myHistory.count(); i++ )
-    stream << myHistory[ i ] << endl;
+    stream << myHistory[ i ] << '\n';
+  stream.flush();
 
+  bool ok = stream.status() == QTextStream::Ok;
   file.close();
-  return true;
+  return ok;
+}
+
+/*!
+  \brief Get maximum number of lines kept in the log window.
+  \return maximum number of lines (0 means unlimited)
+  \sa setMaxLines()
+*/
+int LogWindow::maxLines() const
+{
+  return myMaxLines;
+}
+
+/*!
+  \brief Set maximum number of lines kept in the log window.
+
+  When this limit is exceeded, the oldest lines are removed from both
+  the view and the messages history.
+
+  \param lines maximum number of lines (0 means unlimited)
+  \sa maxLines()
+*/
+void LogWindow::setMaxLines( const int lines )
+{
+  myMaxLines = qMax( lines, 0 );
+  myView->setMaximumBlockCount( myMaxLines );
+  while ( myMaxLines > 0 && myHistory.count() > myMaxLines )
+    myHistory.removeFirst();
 }
 
 /*!
@@ -476,7 +526,34 @@ void LogWindow::qtMessage( QtMsgType type, const QMessageLogContext&, const QStr
     color = QColor("#000000"); // black
     break;
   }
-  putMessage( message, color, DisplayNormal);
+  bool toPost = false;
+  {
+    QMutexLocker lock( &myQtMessagesMutex );
+    toPost = myQtMessages.isEmpty();
+    myQtMessages.append( qMakePair( message, color ) );
+  }
+
+  // messages coming in a burst are shown together on next event loop iteration;
+  // fatal message is shown at once as application is aborted after it
+  if ( type == QtFatalMsg && QThread::currentThread() == thread() )
+    flushQtMessages();
+  else if ( toPost )
+    QMetaObject::invokeMethod( this, "flushQtMessages", Qt::QueuedConnection );
+}
+
+/*!
+  \brief Show Qt messages received since the previous call.
+*/
+void LogWindow::flushQtMessages()
+{
+  QList< QPair<QString, QColor> > messages;
+  {
+    QMutexLocker lock( &myQtMessagesMutex );
+    messages.swap( myQtMessages );
+  }
+
+  for ( int i = 0; i < messages.count(); i++ )
+    putMessage( messages[i].first, messages[i].second, DisplayNormal );
 }
 
 /*!
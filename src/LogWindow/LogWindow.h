@@ -41,7 +41,11 @@
 #include "SUIT_PopupClient.h"
 
 #include <QWidget>
+#include <QColor>
+#include <QList>
 #include <QMap>
+#include <QMutex>
+#include <QPair>
 #include <QStringList>
 
 #ifdef WIN32
@@ -49,7 +53,7 @@
 #endif
 
 class QAction;
-class QTextEdit;
+class QPlainTextEdit;
 
 class LOGWINDOW_EXPORT LogWindow : public QWidget, public SUIT_PopupClient, public QtxMsgHandlerCallback
 {
@@ -98,6 +102,9 @@ public:
 
   bool                saveLog( const QString& );
 
+  int                 maxLines() const;
+  void                setMaxLines( const int );
+
   void                setMenuActions( const int );
   int                 menuActions() const;
 
@@ -109,19 +116,26 @@ protected slots:
   void                onClear();
   void                onCopy();
 
+private slots:
+  void                flushQtMessages();
+
 private:
   void                append( const QString text );
+  void                addHistory( const QString& );
   void                createActions();
   void                updateActions();
   void                qtMessage( QtMsgType, const QMessageLogContext&, const QString& );
 
 private:
-  QTextEdit*          myView;           //!< internal view window
+  QPlainTextEdit*     myView;           //!< internal view window
   QString             myBanner;         //!< current banner
-  QStringList         myHistory;        //!< messages history
+  QStringList         myHistory;        //!< messages history, oldest lines are dropped first
   QString             mySeparator;      //!< current separator
   int                 myBannerSize;     //!< current banner's size
   QMap<int, QAction*> myActions;        //!< popup menu actions
+  int                 myMaxLines;       //!< maximum number of lines kept in view and history
+  QMutex              myQtMessagesMutex; //!< guards pending Qt messages
+  QList< QPair<QString, QColor> > myQtMessages; //!< Qt messages waiting to be shown
 };
 
 #ifdef WIN32
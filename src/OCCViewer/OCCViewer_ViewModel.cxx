@@ -1225,15 +1225,8 @@ bool OCCViewer_Viewer::unHighlightAll( bool updateviewer, bool unselect )
 bool OCCViewer_Viewer::isInViewer( const Handle(AIS_InteractiveObject)& obj,
                                    bool /*onlyInViewer*/ )
 {
-  AIS_ListOfInteractive List;
-  myAISContext->DisplayedObjects(List);
-
-  AIS_ListIteratorOfListOfInteractive ite(List);
-  for ( ; ite.More(); ite.Next() )
-    if( ite.Value()==obj )
-      return true;
-
-  return false;
+  // context keeps display status of each object: no need to scan all displayed objects
+  return !obj.IsNull() && myAISContext->IsDisplayed( obj );
 }
 
 /*!
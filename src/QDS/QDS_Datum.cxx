@@ -1228,6 +1228,8 @@ Handle(DDS_DicItem) QDS_Datum::dicItem() const
 void QDS_Datum::setDicItem( const Handle(DDS_DicItem)& item )
 {
   myDicItem = item;
+
+  delete myValidator;
 }
 
 /*!
@@ -1355,18 +1357,16 @@ bool QDS_Datum::validate( const QString& txt ) const
        ( type() == DDS_DicItem::String && isDoubleFormat( format() ) ) )
     return true;
 
-  QValidator* aValidator = validator( true );
+  // validator is created once, it is recreated only when units system is changed
+  if ( !myValidator )
+    myValidator = validator( true );
 
-  if ( !aValidator )
+  if ( !myValidator )
     return true;
 
   int pos = 0;
   QString str( txt );
-  bool res = aValidator->validate( str, pos ) == QValidator::Acceptable;
-
-  delete aValidator;
-
-  return res;
+  return myValidator->validate( str, pos ) == QValidator::Acceptable;
 }
 
 /*!
@@ -1424,6 +1424,9 @@ void QDS_Datum::initialize()
 */
 void QDS_Datum::unitSystemChanged( const QString& /*unitSystem*/ )
 {
+  // limits of the validator depend on units
+  delete myValidator;
+
   QString labText = label();
   QString unitText = unitsToText( units() );
 
@@ -203,6 +203,8 @@ private:
   QString                   mySourceValue;
   QString                   myTargetValue;
 
+  mutable QPointer<QValidator> myValidator;  // validator with limits used by validate()
+
   bool                      myInitialised, myTr;
 
   friend class QDS;
@@ -0,0 +1,190 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "QDS_LineEdit.h"
+
+#include <DDS_DicItem.h>
+#include <DDS_Dictionary.h>
+
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+#include <QWidget>
+
+namespace
+{
+  const int NbComponents = 20;
+  const int NbItems      = 1000;  // items of each component
+
+  // Identifier of the item of the component
+  QString ItemId( int theComp, int theItem )
+  {
+    return QString( "DATUM_%1_%2" ).arg( theComp ).arg( theItem );
+  }
+
+  // Writes dictionary file: components with the same units systems, float items;
+  // item SHARED is defined in the first and the last components
+  bool WriteDictionary( const QString& theFileName )
+  {
+    QFile aFile( theFileName );
+    if ( !aFile.open( QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text ) )
+      return false;
+
+    QTextStream aStream( &aFile );
+    aStream << "<dictionary>\n";
+    for ( int c = 0; c < NbComponents; c++ ) {
+      aStream << "  <component name=\"COMP_" << c << "\">\n"
+              << "    <unitSystems>\n"
+              << "      <system name=\"SI\" label=\"System international\"/>\n"
+              << "      <system name=\"MM\" label=\"Millimeters\"/>\n"
+              << "    </unitSystems>\n";
+      QStringList anIds;
+      for ( int i = 0; i < NbItems; i++ )
+        anIds << ItemId( c, i );
+      if ( c == 0 || c == NbComponents - 1 )
+        anIds << "SHARED";
+      foreach ( const QString& anId, anIds )
+        aStream << "    <datum id=\"" << anId << "\" label=\"" << anId << " of COMP_" << c << "\""
+                << " SIunits=\"m\" MMunits=\"mm\" format=\"%10.3f\">\n"
+                << "      <domain><valueDescr type=\"Float\" min=\"0\" max=\"100\" default=\"1\"/></domain>\n"
+                << "      <description><shortDescr>" << anId << "</shortDescr></description>\n"
+                << "    </datum>\n";
+      aStream << "  </component>\n";
+    }
+    aStream << "</dictionary>\n";
+    aStream.flush();
+    return aFile.error() == QFile::NoError;
+  }
+
+  // Creates line edits of the items of the last component: the old lookup
+  // of an item asked every component in turn
+  void CreateDatums( int theNumber )
+  {
+    QWidget aParent;
+    for ( int i = 0; i < theNumber; i++ ) {
+      QDS_LineEdit* aDatum = new QDS_LineEdit( ItemId( NbComponents - 1, i % NbItems ), &aParent );
+      CPPUNIT_ASSERT( aDatum->label().startsWith( ItemId( NbComponents - 1, i % NbItems ) ) );
+    }
+  }
+}
+
+/*
+  Class       : TestDictionary
+  Description : Dictionary which index of items can be switched off
+*/
+class TestDictionary : public DDS_Dictionary
+{
+public:
+  static Handle(TestDictionary) Install()
+  {
+    Handle(TestDictionary) aDict = new TestDictionary();
+    SetDictionary( aDict );
+    return aDict;
+  }
+
+  void ClearItemIndex() { myItemIndex.Clear(); }
+  void RebuildItemIndex() { UpdateItemIndex(); }
+};
+
+/*!
+  \class QDSTest: test suit
+*/
+class QDSTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( QDSTest );
+  CPPUNIT_TEST( testDictionary );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void testDictionary();
+};
+
+/*!
+  Load a large dictionary, check lookup of items and measure time of creation
+  of datum widgets and of getting of item properties, with and without
+  the index of items and the cache of units data of the active units system
+*/
+void QDSTest::testDictionary()
+{
+  const int aNbDatums = 2000;
+  const int aNbRequests = 20;
+  QString aFileName = QDir::temp().filePath( "TestQDS_dictionary.xml" );
+  CPPUNIT_ASSERT( WriteDictionary( aFileName ) );
+
+  GuiTest_Timer aTimer( QString( "QDS with %1 items" ).arg( NbComponents * NbItems ) );
+
+  Handle(TestDictionary) aDict = TestDictionary::Install();
+  CPPUNIT_ASSERT( QDS::load( aFileName ) );
+  aTimer.step( "load" );
+  QFile::remove( aFileName );
+
+  // first component wins on duplicated identifiers, with and without the index
+  CPPUNIT_ASSERT( QDS::toQString( aDict->GetDicItem( "SHARED" )->GetLabel() ) == "SHARED of COMP_0" );
+  aDict->ClearItemIndex();
+  CPPUNIT_ASSERT( QDS::toQString( aDict->GetDicItem( "SHARED" )->GetLabel() ) == "SHARED of COMP_0" );
+  CPPUNIT_ASSERT( !aDict->GetDicItem( ItemId( NbComponents - 1, NbItems - 1 ).toLatin1().constData() ).IsNull() );
+
+  // widgets: items found by asking every component in turn, then from the index
+  aTimer.restart();
+  CreateDatums( aNbDatums );
+  aTimer.step( QString( "%1 widgets without index" ).arg( aNbDatums ) );
+  aDict->RebuildItemIndex();
+  aTimer.restart();
+  CreateDatums( aNbDatums );
+  aTimer.step( QString( "%1 widgets with index" ).arg( aNbDatums ) );
+
+  // properties of the items of the last component: the cached units data
+  // is used for the same units system, it is looked up again each time the
+  // system changes
+  QList<Handle(DDS_DicItem)> anItems;
+  for ( int i = 0; i < NbItems; i++ )
+    anItems.append( aDict->GetDicItem( ItemId( NbComponents - 1, i ).toLatin1().constData() ) );
+
+  const DDS_DicItem::UnitSystem aSI( "SI" ), aMM( "MM" );
+  double aSum[2] = { 0, 0 };
+  aTimer.restart();
+  for ( int r = 0; r < aNbRequests; r++ )
+    foreach ( const Handle(DDS_DicItem)& anItem, anItems )
+      aSum[0] += anItem->GetMinValue( aSI ) + anItem->GetMaxValue( aSI ) + anItem->GetPrecision( aSI );
+  aTimer.step( "properties, same units system" );
+  for ( int r = 0; r < aNbRequests; r++ )
+    foreach ( const Handle(DDS_DicItem)& anItem, anItems )
+      aSum[1] += anItem->GetMinValue( r % 2 ? aMM : aSI ) + anItem->GetMaxValue( r % 2 ? aSI : aMM ) +
+                 anItem->GetPrecision( r % 2 ? aMM : aSI );
+  aTimer.step( "properties, alternating units systems" );
+  CPPUNIT_ASSERT( aSum[0] > 0 && aSum[1] > 0 );
+
+  // cached data follows the requested units system
+  const Handle(DDS_DicItem)& anItem = anItems.first();
+  CPPUNIT_ASSERT( anItem->GetUnits( aSI ).IsEqual( "m" ) );
+  CPPUNIT_ASSERT( anItem->GetUnits( aMM ).IsEqual( "mm" ) );
+  CPPUNIT_ASSERT( anItem->GetUnits( aSI ).IsEqual( "m" ) );
+
+  aTimer.print();
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( QDSTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"
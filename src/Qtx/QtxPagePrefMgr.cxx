@@ -218,6 +218,20 @@ void QtxPagePrefMgr::setOptionValue( const QString& name, const QVariant& val )
     QtxPreferenceMgr::setOptionValue( name, val );
 }
 
+/*!
+  \brief Callback function which is called when the widget of
+  the preference item is shown on the screen for the first time
+  or after it has been hidden.
+
+  Can be reimplemented in the subclasses to create contents of pages
+  on demand. Base implementation does nothing.
+
+  \param item preference item which widget is shown
+*/
+void QtxPagePrefMgr::itemShown( QtxPagePrefItem* /*item*/ )
+{
+}
+
 /*!
   \brief Perform internal initialization.
 */
@@ -277,6 +291,9 @@ bool QtxPagePrefItem::Listener::eventFilter( QObject* o, QEvent* e )
   if ( !myItem || myItem->widget() != o )
     return false;
 
+  // only real showing: pages hidden in stacked or tab widgets get ShowToParent as well
+  if ( e->type() == QEvent::Show )
+    myItem->notifyShown();
   if ( e->type() == QEvent::Show || e->type() == QEvent::ShowToParent )
     myItem->widgetShown();
   if ( e->type() == QEvent::Hide || e->type() == QEvent::HideToParent )
@@ -445,6 +462,16 @@ void QtxPagePrefItem::pageChildItems( QList<QtxPagePrefItem*>& list, const bool
   }
 }
 
+/*!
+  \brief Notify preference manager that the item widget is shown.
+*/
+void QtxPagePrefItem::notifyShown()
+{
+  QtxPagePrefMgr* mgr = dynamic_cast<QtxPagePrefMgr*>( preferenceMgr() );
+  if ( mgr )
+    mgr->itemShown( this );
+}
+
 /*!
   \brief Called when contents is changed (item is added, removed or modified).
 
@@ -86,6 +86,8 @@ protected:
   virtual QVariant optionValue( const QString& ) const;
   virtual void     setOptionValue( const QString&, const QVariant& );
 
+  virtual void     itemShown( QtxPagePrefItem* );
+
 private:
   void             initialize() const;
   void             initialize( QtxPreferenceItem* );
@@ -93,6 +95,8 @@ private:
 private:
   QtxGridBox*      myBox;
   bool             myInit;
+
+  friend class QtxPagePrefItem;
 };
 
 class QTX_EXPORT QtxPagePrefItem : public QtxPreferenceItem
@@ -127,6 +131,7 @@ protected:
 
 private:
   virtual void      contentChanged();
+  void              notifyShown();
 
 private:
   QPointer<QWidget> myWidget;
@@ -891,6 +891,21 @@ void QtxPreferenceItem::sendItemChanges()
     parentItem()->itemChanged( this );
 }
 
+/*!
+  \brief Assign identifier of another item to the preference item.
+
+  Used when an item is replaced by another one which should be accessible
+  by the same identifier.
+
+  \param item preference item
+  \param id item ID
+*/
+void QtxPreferenceItem::setItemId( QtxPreferenceItem* item, const int id )
+{
+  if ( item )
+    item->myId = id;
+}
+
 /*!
   \brief Generate unique preference item identifier.
   \return unique item ID
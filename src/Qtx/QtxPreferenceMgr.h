@@ -128,6 +128,8 @@ protected:
   virtual QVariant          optionValue( const QString& ) const;
   virtual void              setOptionValue( const QString&, const QVariant& );
 
+  static void               setItemId( QtxPreferenceItem*, const int );
+
 protected:
   typedef QList<QtxPreferenceItem*> ItemList;
 
@@ -27,7 +27,13 @@
 #include "QtxTranslator.h"
 
 #include <QSet>
+#include <QHash>
 #include <QDir>
+#include <QDataStream>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QCryptographicHash>
+#include <QSaveFile>
 #include <QFile>
 #include <QFileInfo>
 #include <QJsonDocument>
@@ -68,6 +74,22 @@ static const char* pixmap_not_found_xpm[] = {
 "                ",
 "                "};
 
+namespace
+{
+  //! Binary resources cache file signature ("QRC1") and version
+  enum { CacheMagic = 0x51524331, CacheVersion = 1 };
+
+  //! Kinds of values stored in the resolved values cache of the resources manager
+  enum { StringCache, RawStringCache, IntegerCache, DoubleCache, BooleanCache, ColorCache, FontCache };
+
+  //! Get key of the parameter value in the resolved values cache
+  QString cacheKey( const QString& sect, const QString& name, const int type )
+  {
+    const QChar sep( 0x1f ); // unit separator: can't appear in section and parameter names
+    return QString::number( type ) + sep + sect + sep + name;
+  }
+}
+
 /*!
   \class QtxResourceMgr::Resources
   \internal
@@ -77,7 +99,7 @@ static const char* pixmap_not_found_xpm[] = {
 class QtxResourceMgr::Resources
 {
 private:
-  typedef QMap<QString, Section> SectionMap;
+  typedef QHash<QString, Section> SectionMap;
   typedef QMap<QString, QString> OptionsMap;
 
 public:
@@ -110,8 +132,8 @@ protected:
   QtxResourceMgr*        resMgr() const;
 
 private:
-  Section                section( const QString& );
-  const Section          section( const QString& ) const;
+  Section&               section( const QString& );
+  const Section&         section( const QString& ) const;
 
   QString                makeSubstitution( const QString&, const QString&, const QString&, const OptionsMap& ) const;
 
@@ -179,9 +201,10 @@ QString QtxResourceMgr::Resources::value( const QString& sect, const QString& na
 {
   QString val;
 
-  if ( hasValue( sect, name ) )
+  SectionMap::ConstIterator it = mySections.constFind( sect );
+  if ( it != mySections.constEnd() && it.value().contains( name ) )
   {
-    val = section( sect )[name];
+    val = it.value()[name];
     if ( subst )
       val = makeSubstitution( val, sect, name, constants );
   }
@@ -197,10 +220,7 @@ QString QtxResourceMgr::Resources::value( const QString& sect, const QString& na
 */
 void QtxResourceMgr::Resources::setValue( const QString& sect, const QString& name, const QString& val )
 {
-  if ( !mySections.contains( sect ) )
-    mySections.insert( sect, Section() );
-
-  mySections[sect].insert( name, val );
+  section( sect ).insert( name, val );
 }
 
 /*!
@@ -221,7 +241,8 @@ bool QtxResourceMgr::Resources::hasSection( const QString& sect ) const
 */
 bool QtxResourceMgr::Resources::hasValue( const QString& sect, const QString& name ) const
 {
-  return hasSection( sect ) && section( sect ).contains( name );
+  SectionMap::ConstIterator it = mySections.constFind( sect );
+  return it != mySections.constEnd() && it.value().contains( name );
 }
 
 /*!
@@ -240,13 +261,14 @@ void QtxResourceMgr::Resources::removeSection( const QString& sect )
 */
 void QtxResourceMgr::Resources::removeValue( const QString& sect, const QString& name )
 {
-  if ( !mySections.contains( sect ) )
+  SectionMap::Iterator it = mySections.find( sect );
+  if ( it == mySections.end() )
     return;
 
-  mySections[sect].remove( name );
+  it.value().remove( name );
 
-  if ( mySections[sect].isEmpty() )
-    mySections.remove( sect );
+  if ( it.value().isEmpty() )
+    mySections.erase( it );
 }
 
 /*!
@@ -263,7 +285,9 @@ void QtxResourceMgr::Resources::clear()
 */
 QStringList QtxResourceMgr::Resources::sections() const
 {
-  return mySections.keys();
+  QStringList lst = mySections.keys();
+  lst.sort();
+  return lst;
 }
 
 /*!
@@ -322,11 +346,9 @@ QtxResourceMgr* QtxResourceMgr::Resources::resMgr() const
   \param sn section name
   \return resources section
 */
-QtxResourceMgr::Section QtxResourceMgr::Resources::section( const QString& sn )
+QtxResourceMgr::Section& QtxResourceMgr::Resources::section( const QString& sn )
 {
-  if ( !mySections.contains( sn ) )
-    mySections.insert( sn, Section() );
-
+  // QHash::operator[] inserts default-constructed (empty) section if it does not exist
   return mySections[sn];
 }
 
@@ -335,9 +357,11 @@ QtxResourceMgr::Section QtxResourceMgr::Resources::section( const QString& sn )
   \param sn section name
   \return resources section
 */
-const QtxResourceMgr::Section QtxResourceMgr::Resources::section( const QString& sn ) const
+const QtxResourceMgr::Section& QtxResourceMgr::Resources::section( const QString& sn ) const
 {
-  return mySections[sn];
+  static const Section empty;
+  SectionMap::ConstIterator it = mySections.constFind( sn );
+  return it != mySections.constEnd() ? it.value() : empty;
 }
 
 /*!
@@ -564,6 +588,8 @@ bool QtxResourceMgr::IniFormat::load( const QString& fname, QMap<QString, Sectio
   else
     return true;   // already imported (prevent import loops)
 
+  addDependency( aFName );
+
   QFile file( aFName );
   if ( !file.open( QFile::ReadOnly ) )
     return false;  // file is not accessible
@@ -621,6 +647,7 @@ bool QtxResourceMgr::IniFormat::load( const QString& fname, QMap<QString, Sectio
       QFileInfo impFInfo( impFile );
       if ( impFInfo.isRelative() )
         impFInfo.setFile( aFinfo.absoluteDir(), impFile );
+      addImport( data, aFinfo.absolutePath(), impFInfo.absoluteFilePath() );
 
       QMap<QString, Section> impMap;
       if ( !load( impFInfo.absoluteFilePath(), impMap, importHistory ) )
@@ -784,6 +811,8 @@ bool QtxResourceMgr::XmlFormat::load( const QString& fname, QMap<QString, Sectio
   else
     return true;   // already imported (prevent import loops)
 
+  addDependency( aFName );
+
   bool res = false;
 
 #ifndef QT_NO_DOM
@@ -859,6 +888,7 @@ bool QtxResourceMgr::XmlFormat::load( const QString& fname, QMap<QString, Sectio
 	      QFileInfo impFInfo( impFile );
 	      if ( impFInfo.isRelative() )
 	         impFInfo.setFile( aFinfo.absoluteDir(), impFile );
+        addImport( sectElem.attribute( nameAttribute() ), aFinfo.absolutePath(), impFInfo.absoluteFilePath() );
 
         QMap<QString, Section> impMap;
         if ( !load( impFInfo.absoluteFilePath(), impMap, importHistory ) )
@@ -1117,6 +1147,8 @@ bool QtxResourceMgr::JsonFormat::load( const QString& fname, QMap<QString, Secti
   else
     return true;   // already imported (prevent import loops)
 
+  addDependency( aFName );
+
   QFile file( aFName );
   if ( !file.open( QFile::ReadOnly ) )
     return false;  // file is not accessible
@@ -1137,6 +1169,7 @@ bool QtxResourceMgr::JsonFormat::load( const QString& fname, QMap<QString, Secti
       QFileInfo impFInfo( impPath );
       if ( impFInfo.isRelative() )
         impFInfo.setFile( aFinfo.absoluteDir(), impPath );
+      addImport( impFile, aFinfo.absolutePath(), impFInfo.absoluteFilePath() );
       QMap<QString, Section> impMap;
       if ( !load( impFInfo.absoluteFilePath(), impMap, importHistory ) )
       {
@@ -1315,6 +1348,208 @@ void QtxResourceMgr::Format::setOption( const QString& opt, const QString& val )
   myOpt.insert( opt, val );
 }
 
+/*!
+  \brief Register file which is read by the current load operation.
+
+  Should be called by the successors for each file being parsed (including
+  imported files), in order to allow the binary cache of the resources
+  file to be validated. If the successor class does not register read files,
+  its resources are never cached.
+
+  \param fname file name
+  \sa addImport()
+*/
+void QtxResourceMgr::Format::addDependency( const QString& fname )
+{
+  if ( !myDeps.contains( fname ) )
+    myDeps.append( fname );
+}
+
+/*!
+  \brief Register import directive processed by the current load operation.
+
+  The directive can refer to environment variables; it is evaluated again
+  while validating the binary cache, so that cache is not used if it
+  now refers to another file.
+
+  \param directive import directive (file name, as specified in the resources file)
+  \param dir directory of the resources file containing import directive
+  \param fname absolute file name the directive is resolved to
+  \sa addDependency()
+*/
+void QtxResourceMgr::Format::addImport( const QString& directive, const QString& dir, const QString& fname )
+{
+  myImports.append( QStringList() << directive << dir << fname );
+  addDependency( fname );
+}
+
+/*!
+  \brief Get name of the binary cache file for the resources file.
+  \param dir cache directory
+  \param fname resources file name
+  \return cache file name or null string if cache is disabled
+*/
+QString QtxResourceMgr::Format::cacheFileName( const QString& dir, const QString& fname ) const
+{
+  if ( dir.isEmpty() || fname.isEmpty() )
+    return QString();
+
+  QCryptographicHash hash( QCryptographicHash::Md5 );
+  hash.addData( QFileInfo( fname ).absoluteFilePath().toUtf8() );
+  hash.addData( format().toUtf8() );
+  return Qtx::addSlash( dir ) + QString::fromLatin1( hash.result().toHex() ) + ".cache";
+}
+
+/*!
+  \brief Get state of the file used to validate binary cache.
+  \param fname file name
+  \param mtime returns modification time (msecs since epoch), -1 if file does not exist
+  \param size returns file size, -1 if file does not exist
+*/
+static void fileState( const QString& fname, qint64& mtime, qint64& size )
+{
+  QFileInfo fi( fname );
+  mtime = fi.exists() ? fi.lastModified().toMSecsSinceEpoch() : -1;
+  size  = fi.exists() ? fi.size() : -1;
+}
+
+/*!
+  \brief Read resources from the binary cache file.
+
+  The cache file is used only if it was built from the
+  same resources file with the same format options, if none of the files read
+  while building it have been changed since (modification time and size are
+  compared) and if all import directives still refer to the same files.
+
+  \param cacheFile cache file name
+  \param fname resources file name
+  \param secMap resources map to be filled in
+  \return \c true if valid cache was found and read
+*/
+bool QtxResourceMgr::Format::readCache( const QString& cacheFile, const QString& fname, QMap<QString, Section>& secMap ) const
+{
+  QFile file( cacheFile );
+  if ( !file.open( QFile::ReadOnly ) || file.size() <= 0 )
+    return false;
+
+  QDataStream stream( &file );
+  stream.setVersion( QDataStream::Qt_5_0 );
+
+  bool ok = false;
+  quint32 magic, version;
+  stream >> magic >> version;
+  if ( magic == CacheMagic && version == CacheVersion )
+  {
+    QString srcName, fmtName;
+    QMap<QString, QString> opts;
+    stream >> srcName >> fmtName >> opts;
+    ok = srcName == QFileInfo( fname ).absoluteFilePath() && fmtName == format() && opts == myOpt;
+
+    // check that files used to build the cache are not modified
+    quint32 nbDeps = 0;
+    stream >> nbDeps;
+    for ( quint32 i = 0; i < nbDeps && stream.status() == QDataStream::Ok; i++ )
+    {
+      QString depName;
+      qint64 depTime, depSize, curTime, curSize;
+      stream >> depName >> depTime >> depSize;
+      if ( ok )
+      {
+        fileState( depName, curTime, curSize );
+        ok = curTime == depTime && curSize == depSize;
+      }
+    }
+
+    // check that import directives are resolved to the same files
+    quint32 nbImports = 0;
+    stream >> nbImports;
+    for ( quint32 i = 0; i < nbImports && stream.status() == QDataStream::Ok; i++ )
+    {
+      QString directive, dir, impName;
+      stream >> directive >> dir >> impName;
+      if ( ok )
+      {
+        QString impFile = QDir::toNativeSeparators( Qtx::makeEnvVarSubst( directive, Qtx::Always ) );
+        QFileInfo impFInfo( impFile );
+        if ( impFInfo.isRelative() )
+          impFInfo.setFile( QDir( dir ), impFile );
+        ok = impFInfo.absoluteFilePath() == impName;
+      }
+    }
+
+    quint32 nbSections = 0;
+    if ( ok )
+      stream >> nbSections;
+    for ( quint32 i = 0; i < nbSections && stream.status() == QDataStream::Ok; i++ )
+    {
+      QString sectName;
+      quint32 nbParams = 0;
+      stream >> sectName >> nbParams;
+      Section& sect = secMap[sectName];
+      for ( quint32 j = 0; j < nbParams && stream.status() == QDataStream::Ok; j++ )
+      {
+        QString paramName, paramValue;
+        stream >> paramName >> paramValue;
+        sect.insert( paramName, paramValue );
+      }
+    }
+    ok = ok && stream.status() == QDataStream::Ok;
+  }
+
+  if ( !ok )
+    secMap.clear();
+  return ok;
+}
+
+/*!
+  \brief Write resources to the binary cache file.
+
+  Cache is not written if the format has not registered any files
+  read by the load operation (see addDependency()).
+
+  \param cacheFile cache file name
+  \param fname resources file name
+  \param secMap resources map
+  \return \c true on success and \c false on error
+*/
+bool QtxResourceMgr::Format::writeCache( const QString& cacheFile, const QString& fname, const QMap<QString, Section>& secMap ) const
+{
+  if ( myDeps.isEmpty() || !Qtx::mkDir( QFileInfo( cacheFile ).absolutePath() ) )
+    return false;
+
+  QSaveFile file( cacheFile );
+  if ( !file.open( QFile::WriteOnly ) )
+    return false;
+
+  QDataStream stream( &file );
+  stream.setVersion( QDataStream::Qt_5_0 );
+
+  stream << (quint32)CacheMagic << (quint32)CacheVersion;
+  stream << QFileInfo( fname ).absoluteFilePath() << format() << myOpt;
+
+  stream << (quint32)myDeps.count();
+  foreach ( QString depName, myDeps )
+  {
+    qint64 depTime, depSize;
+    fileState( depName, depTime, depSize );
+    stream << depName << depTime << depSize;
+  }
+
+  stream << (quint32)myImports.count();
+  foreach ( QStringList imp, myImports )
+    stream << imp.value( 0 ) << imp.value( 1 ) << imp.value( 2 );
+
+  stream << (quint32)secMap.count();
+  for ( QMap<QString, Section>::ConstIterator it = secMap.constBegin(); it != secMap.constEnd(); ++it )
+  {
+    stream << it.key() << (quint32)it.value().count();
+    for ( Section::ConstIterator iter = it.value().begin(); iter != it.value().end(); ++iter )
+      stream << iter.key() << iter.value();
+  }
+
+  return stream.status() == QDataStream::Ok && file.commit();
+}
+
 /*!
   \brief Load resources from the resource file.
   \param res resources object
@@ -1325,10 +1560,37 @@ bool QtxResourceMgr::Format::load( Resources* res )
   if ( !res )
     return false;
 
+  QtxResourceMgr* mgr = res->resMgr();
+
+  QElapsedTimer timer;
+  timer.start();
+
+  // user file is modified by the application itself: only global files are cached
+  bool isUser = mgr && mgr->myHasUserValues && !mgr->myResources.isEmpty() && mgr->myResources.first() == res;
+
   QMap<QString, Section> sections;
-  bool status = load( res->myFileName, sections );
+  QString cacheFile = mgr && !isUser ? cacheFileName( mgr->cacheDir(), res->myFileName ) : QString();
+  bool cached = !cacheFile.isEmpty() && readCache( cacheFile, res->myFileName, sections );
+  bool status = cached;
+  if ( !cached )
+  {
+    myDeps.clear();
+    myImports.clear();
+    status = load( res->myFileName, sections );
+    if ( status && !cacheFile.isEmpty() )
+      writeCache( cacheFile, res->myFileName, sections );
+  }
+
+  if ( mgr )
+    mgr->fileLoaded( res->myFileName, timer.nsecsElapsed() / 1000, cached );
+
   if ( status )
-    res->mySections = sections;
+  {
+    res->mySections.clear();
+    res->mySections.reserve( sections.count() );
+    for ( QMap<QString, Section>::ConstIterator it = sections.constBegin(); it != sections.constEnd(); ++it )
+      res->mySections.insert( it.key(), it.value() );
+  }
   else
     qDebug() << "QtxResourceMgr: Can't load resource file:" << res->myFileName;
 
@@ -1352,8 +1614,13 @@ bool QtxResourceMgr::Format::save( Resources* res )
 
   Qtx::mkDir( Qtx::dir( res->myFileName ) );
 
+  // sections are written in alphabetical order
+  QMap<QString, Section> sections;
+  for ( Resources::SectionMap::ConstIterator it = res->mySections.constBegin(); it != res->mySections.constEnd(); ++it )
+    sections.insert( it.key(), it.value() );
+
   QString name = mgr ? mgr->userFileName( mgr->appName(), false ) : res->myFileName;
-  return save( name, res->mySections );
+  return save( name, sections );
 }
 
 /*!
@@ -1635,6 +1902,8 @@ void QtxResourceMgr::clear()
 {
   for ( ResList::Iterator it = myResources.begin(); it != myResources.end(); ++it )
     (*it)->clear();
+
+  clearCache();
 }
 
 /*!
@@ -1665,6 +1934,8 @@ QtxResourceMgr::WorkingMode QtxResourceMgr::setWorkingMode( WorkingMode mode )
 {
   WorkingMode m = myWorkingMode;
   myWorkingMode = mode;
+  if ( m != mode )
+    clearCache();
   return m;
 }
 
@@ -1678,13 +1949,20 @@ QtxResourceMgr::WorkingMode QtxResourceMgr::setWorkingMode( WorkingMode mode )
 */
 bool QtxResourceMgr::value( const QString& sect, const QString& name, int& iVal ) const
 {
-  QString val;
-  if ( !value( sect, name, val, true ) )
-    return false;
+  QVariant cached;
+  if ( cachedValue( sect, name, IntegerCache, cached ) )
+  {
+    if ( cached.isValid() )
+      iVal = cached.toInt();
+    return cached.isValid();
+  }
 
-  bool ok;
-  iVal = val.toInt( &ok );
+  QString val;
+  bool ok = value( sect, name, val, true );
+  if ( ok )
+    iVal = val.toInt( &ok );
 
+  cacheValue( sect, name, IntegerCache, ok ? QVariant( iVal ) : QVariant() );
   return ok;
 }
 
@@ -1698,13 +1976,20 @@ bool QtxResourceMgr::value( const QString& sect, const QString& name, int& iVal
 */
 bool QtxResourceMgr::value( const QString& sect, const QString& name, double& dVal ) const
 {
-  QString val;
-  if ( !value( sect, name, val, true ) )
-    return false;
+  QVariant cached;
+  if ( cachedValue( sect, name, DoubleCache, cached ) )
+  {
+    if ( cached.isValid() )
+      dVal = cached.toDouble();
+    return cached.isValid();
+  }
 
-  bool ok;
-  dVal = val.toDouble( &ok );
+  QString val;
+  bool ok = value( sect, name, val, true );
+  if ( ok )
+    dVal = val.toDouble( &ok );
 
+  cacheValue( sect, name, DoubleCache, ok ? QVariant( dVal ) : QVariant() );
   return ok;
 }
 
@@ -1718,9 +2003,20 @@ bool QtxResourceMgr::value( const QString& sect, const QString& name, double& dV
 */
 bool QtxResourceMgr::value( const QString& sect, const QString& name, bool& bVal ) const
 {
+  QVariant cached;
+  if ( cachedValue( sect, name, BooleanCache, cached ) )
+  {
+    if ( cached.isValid() )
+      bVal = cached.toBool();
+    return cached.isValid();
+  }
+
   QString val;
   if ( !value( sect, name, val, true ) )
+  {
+    cacheValue( sect, name, BooleanCache, QVariant() );
     return false;
+  }
 
   static QMap<QString, bool> boolMap;
   if ( boolMap.isEmpty() )
@@ -1740,6 +2036,7 @@ bool QtxResourceMgr::value( const QString& sect, const QString& name, bool& bVal
       bVal = num != 0;
   }
 
+  cacheValue( sect, name, BooleanCache, res ? QVariant( bVal ) : QVariant() );
   return res;
 }
 
@@ -1753,11 +2050,19 @@ bool QtxResourceMgr::value( const QString& sect, const QString& name, bool& bVal
 */
 bool QtxResourceMgr::value( const QString& sect, const QString& name, QColor& cVal ) const
 {
+  QVariant cached;
+  if ( cachedValue( sect, name, ColorCache, cached ) )
+  {
+    if ( cached.isValid() )
+      cVal = cached.value<QColor>();
+    return cached.isValid();
+  }
+
   QString val;
-  if ( !value( sect, name, val, true ) )
-    return false;
+  bool ok = value( sect, name, val, true ) && Qtx::stringToColor( val, cVal );
 
-  return Qtx::stringToColor( val, cVal );
+  cacheValue( sect, name, ColorCache, ok ? QVariant( cVal ) : QVariant() );
+  return ok;
 }
 
 /*!
@@ -1770,18 +2075,25 @@ bool QtxResourceMgr::value( const QString& sect, const QString& name, QColor& cV
 */
 bool QtxResourceMgr::value( const QString& sect, const QString& name, QFont& fVal ) const
 {
-  QString val;
-  if ( !value( sect, name, val, true ) )
-    return false;
-
-  QStringList fontDescr = val.split( ",", QString::SkipEmptyParts );
+  QVariant cached;
+  if ( cachedValue( sect, name, FontCache, cached ) )
+  {
+    if ( cached.isValid() )
+      fVal = cached.value<QFont>();
+    return cached.isValid();
+  }
 
-  if ( fontDescr.count() < 2 )
-    return false;
+  QString val;
+  QStringList fontDescr;
+  if ( value( sect, name, val, true ) )
+    fontDescr = val.split( ",", QString::SkipEmptyParts );
 
-  QString family = fontDescr[0];
+  QString family = fontDescr.count() < 2 ? QString() : fontDescr[0];
   if ( family.isEmpty() )
+  {
+    cacheValue( sect, name, FontCache, QVariant() );
     return false;
+  }
 
   fVal = QFont( family );
 
@@ -1805,6 +2117,7 @@ bool QtxResourceMgr::value( const QString& sect, const QString& name, QFont& fVa
     }
   }
 
+  cacheValue( sect, name, FontCache, QVariant( fVal ) );
   return true;
 }
 
@@ -1933,6 +2246,14 @@ bool QtxResourceMgr::value( const QString& sect, const QString& name, QString& v
 {
   initialize();
 
+  QVariant cached;
+  if ( cachedValue( sect, name, subst ? StringCache : RawStringCache, cached ) )
+  {
+    if ( cached.isValid() )
+      val = cached.toString();
+    return cached.isValid();
+  }
+
   bool ok = false;
  
   ResList::ConstIterator it = myResources.begin();
@@ -1946,6 +2267,7 @@ bool QtxResourceMgr::value( const QString& sect, const QString& name, QString& v
       val = (*it)->value( sect, name, subst, myConstants );
   }
 
+  cacheValue( sect, name, subst ? StringCache : RawStringCache, ok ? QVariant( val ) : QVariant() );
   return ok;
 }
 
@@ -2391,6 +2713,8 @@ void QtxResourceMgr::remove( const QString& sect )
 
   for ( ResList::Iterator it = myResources.begin(); it != myResources.end(); ++it )
     (*it)->removeSection( sect );
+
+  clearCache();
 }
 
 /*!
@@ -2404,6 +2728,8 @@ void QtxResourceMgr::remove( const QString& sect, const QString& name )
 
   for ( ResList::Iterator it = myResources.begin(); it != myResources.end(); ++it )
     (*it)->removeValue( sect, name );
+
+  clearCache();
 }
 
 /*!
@@ -2554,7 +2880,67 @@ QString QtxResourceMgr::constant( const QString& name ) const
 void QtxResourceMgr::setConstant( const QString& name, const QString& value )
 {
   if ( !name.isEmpty() )
+  {
     myConstants.insert( name, value );
+    clearCache();
+  }
+}
+
+/*!
+  \brief Get binary resources cache directory.
+  \return cache directory (null string if binary cache is disabled)
+  \sa setCacheDir()
+*/
+QString QtxResourceMgr::cacheDir() const
+{
+  return myCacheDir;
+}
+
+/*!
+  \brief Set binary resources cache directory.
+
+  When cache directory is set, each global resources file parsed by the resources
+  manager is additionally stored in the binary format to this directory.
+  On the next load the binary copy is read instead of parsing the resources
+  file, unless this file (or any file imported by it) has changed.
+  User resources file is never cached.
+
+  Pass null string to disable binary cache (default).
+
+  \param dir cache directory
+  \sa cacheDir()
+*/
+void QtxResourceMgr::setCacheDir( const QString& dir )
+{
+  myCacheDir = dir;
+}
+
+/*!
+  \brief Get time spent to load each resources file.
+
+  Set QTX_RESOURCES_TIMING environment variable to a non-empty value to
+  additionally print load time of each file to the debug output.
+
+  \return map of resources file name to load time, in microseconds
+*/
+QMap<QString, qint64> QtxResourceMgr::loadTimes() const
+{
+  return myLoadTimes;
+}
+
+/*!
+  \brief Called when resources file is loaded.
+  \param fname resources file name
+  \param usecs time spent to load file, in microseconds
+  \param cached \c true if file was loaded from binary cache
+*/
+void QtxResourceMgr::fileLoaded( const QString& fname, const qint64 usecs, const bool cached )
+{
+  myLoadTimes.insert( fname, usecs );
+
+  static const bool isTimingOn = !Qtx::getenv( "QTX_RESOURCES_TIMING" ).isEmpty();
+  if ( isTimingOn )
+    qDebug() << "QtxResourceMgr:" << fname << "loaded in" << usecs << "us" << ( cached ? "(cached)" : "(parsed)" );
 }
 
 /*!
@@ -2574,6 +2960,7 @@ bool QtxResourceMgr::load()
   for ( ResList::Iterator it = myResources.begin(); it != myResources.end(); ++it )
     res = fmt->load( *it ) && res;
 
+  clearCache();
   return res;
 }
 
@@ -2599,6 +2986,7 @@ bool QtxResourceMgr::import( const QString& fname )
   r->setFile( fname );
   bool res = fmt->load( r );
   r->setFile( old );
+  clearCache();
   return res;
 }
 
@@ -2657,6 +3045,7 @@ bool QtxResourceMgr::addResource( const QString& fname )
 
   myDirList << dirName;
   myResources << resource;
+  clearCache();
   return true;
 }
 
@@ -3229,6 +3618,7 @@ void QtxResourceMgr::setDirList( const QStringList& dl )
     delete *it;
 
   myResources.clear();
+  clearCache();
 }
 
 /*!
@@ -3242,7 +3632,10 @@ void QtxResourceMgr::setResource( const QString& sect, const QString& name, cons
   initialize();
 
   if ( !myResources.isEmpty() && myHasUserValues )
+  {
     myResources.first()->setValue( sect, name, val );
+    clearCache();
+  }
 }
 
 /*!
@@ -3312,6 +3705,56 @@ void QtxResourceMgr::saved()
 {
 }
 
+/*!
+  \brief Get parameter value from the resolved values cache.
+
+  Values are cached after substitution of variables and conversion to the
+  requested type, so that repeated lookups of the same parameter do not walk
+  the resources files list and re-parse the value.
+  A null variant is cached for the parameters which are not found or can not
+  be converted to the requested type.
+
+  \param sect section name
+  \param name parameter name
+  \param type kind of the cached value
+  \param val variable to return cached value
+  \return \c true if the value is found in the cache
+  \sa cacheValue(), clearCache()
+*/
+bool QtxResourceMgr::cachedValue( const QString& sect, const QString& name, const int type, QVariant& val ) const
+{
+  ValueCache::ConstIterator it = myCache.constFind( cacheKey( sect, name, type ) );
+  if ( it == myCache.constEnd() )
+    return false;
+
+  val = it.value();
+  return true;
+}
+
+/*!
+  \brief Put parameter value to the resolved values cache.
+  \param sect section name
+  \param name parameter name
+  \param type kind of the cached value
+  \param val value (null variant if parameter is not found)
+  \sa cachedValue(), clearCache()
+*/
+void QtxResourceMgr::cacheValue( const QString& sect, const QString& name, const int type, const QVariant& val ) const
+{
+  myCache.insert( cacheKey( sect, name, type ), val );
+}
+
+/*!
+  \brief Clear the resolved values cache.
+
+  Called whenever resources, constants or working mode are changed.
+  \sa cachedValue(), cacheValue()
+*/
+void QtxResourceMgr::clearCache()
+{
+  myCache.clear();
+}
+
 /*!
   \brief Perform substitution of the patterns like \%A, \%B, etc by values from the map.
 
@@ -33,12 +33,14 @@
 #endif
 
 #include <QMap>
+#include <QHash>
 #include <QList>
 #include <QFont>
 #include <QColor>
 #include <QPixmap>
 #include <QByteArray>
 #include <QStringList>
+#include <QVariant>
 #include <QLinearGradient>
 #include <QRadialGradient>
 #include <QConicalGradient>
@@ -168,6 +170,10 @@ public:
 
   QString          path( const QString&, const QString&, const QString& ) const;
 
+  virtual QString  cacheDir() const;
+  void             setCacheDir( const QString& );
+  QMap<QString, qint64> loadTimes() const;
+
   bool             load();
   bool             import( const QString& );
   bool             save();
@@ -199,12 +205,19 @@ private:
   void             initialize( const bool = true ) const;
   QString          substMacro( const QString&, const QMap<QChar, QString>& ) const;
 
+  void             fileLoaded( const QString&, const qint64, const bool );
+
+  bool             cachedValue( const QString&, const QString&, const int, QVariant& ) const;
+  void             cacheValue( const QString&, const QString&, const int, const QVariant& ) const;
+  void             clearCache();
+
 private:
   typedef QList<Resources*>        ResList;
   typedef QList<QTranslator*>      TransList;
   typedef QList<Format*>           FormatList;
   typedef QMap<QString, QString>   OptionsMap;
   typedef QMap<QString, TransList> TransListMap;
+  typedef QHash<QString, QVariant> ValueCache;
 
 private:
   QString          myAppName;                 //!< application name
@@ -221,6 +234,11 @@ private:
   bool             myHasUserValues;           //!< \c true if user preferences has been read
   WorkingMode      myWorkingMode;             //!< working mode
 
+  mutable ValueCache myCache;                 //!< resolved (substituted and parsed) values
+
+  QString          myCacheDir;                //!< binary resources cache directory
+  QMap<QString, qint64> myLoadTimes;          //!< resources files load time (microseconds)
+
   friend class QtxResourceMgr::Format;
 };
 
@@ -243,9 +261,19 @@ protected:
   virtual bool           load( const QString&, QMap<QString, Section>& ) = 0;
   virtual bool           save( const QString&, const QMap<QString, Section>& ) = 0;
 
+  void                   addDependency( const QString& );
+  void                   addImport( const QString&, const QString&, const QString& );
+
+private:
+  QString                cacheFileName( const QString&, const QString& ) const;
+  bool                   readCache( const QString&, const QString&, QMap<QString, Section>& ) const;
+  bool                   writeCache( const QString&, const QString&, const QMap<QString, Section>& ) const;
+
 private:
-  QString                myFmt;    //!< format name
-  QMap<QString, QString> myOpt;    //!< options map
+  QString                myFmt;     //!< format name
+  QMap<QString, QString> myOpt;     //!< options map
+  QStringList            myDeps;    //!< files read by the last load operation
+  QList<QStringList>     myImports; //!< import directives processed by the last load operation
 };
 
 #endif // QTXRESOURCEMGR_H
@@ -23,17 +23,23 @@
 #include "QtxSearchTool.h"
 
 #include <QApplication>
+#include <QAtomicInt>
 #include <QCheckBox>
 #include <QEvent>
 #include <QHBoxLayout>
 #include <QKeyEvent>
 #include <QLineEdit>
 #include <QPersistentModelIndex>
+#include <QRegExp>
+#include <QRunnable>
 #include <QShortcut>
+#include <QThreadPool>
 #include <QTimer>
 #include <QToolButton>
 #include <QTreeView>
 
+#include <algorithm>
+
 const char* const first_xpm[] = {
 "16 16 14 1",
 "       c None",
@@ -277,7 +283,8 @@ QtxSearchTool::QtxSearchTool( QWidget* parent, QWidget* watched, int controls, Q
   myControls( controls ),
   myActivators( None ),
   myAutoHideTimer( 0 ),
-  myAutoHideEnabled( true )
+  myAutoHideEnabled( true ),
+  myLastSearch( fAny )
 {
   init( orientation );
 }
@@ -301,7 +308,8 @@ QtxSearchTool::QtxSearchTool( QWidget* parent, int controls, Qt::Orientation ori
   myControls( controls ),
   myActivators( None ),
   myAutoHideTimer( 0 ),
-  myAutoHideEnabled( true )
+  myAutoHideEnabled( true ),
+  myLastSearch( fAny )
 {
   init( orientation );
 }
@@ -813,6 +821,18 @@ void QtxSearchTool::findLast()
   find( myData->text(), fLast );
 }
 
+/*!
+  \brief Repeat last search operation.
+
+  This method is called by the searchers, which find data asynchronously,
+  when the result of the search becomes available.
+*/
+void QtxSearchTool::repeatSearch()
+{
+  if ( isVisible() )
+    find( myData->text(), myLastSearch );
+}
+
 /*!
   \brief Perform search.
   \internal
@@ -830,6 +850,8 @@ void QtxSearchTool::find( const QString& what, int where )
               QApplication::palette( myData ).color( QPalette::Active,
                                                      QPalette::Base ) );
 
+  myLastSearch = where;
+
   bool found = true;
   if ( mySearcher && !what.isEmpty() )
   {
@@ -1141,6 +1163,21 @@ QtxSearchTool::Searcher::~Searcher()
   The column for which data should be searched can be get/set with the
   searchColumn(), setSearchColumn() methods.
   By default, column 0 is used.
+
+  To avoid retrieving data of all the items of the model on each search,
+  the searcher keeps texts of the items in the order of the tree traversal.
+  This index is built on first search; texts of modified items are then
+  updated incrementally, while any change of the model structure (for example,
+  insertion or removal of rows) only marks the index as out of date, so that
+  it is rebuilt once, on next search, whatever the number of changes is.
+
+  When the searched text is extended (as it happens when the user types
+  the text), only items found by previous search are checked.
+
+  For large models regular expressions are matched in the worker threads:
+  the search returns immediately and, when matching is finished, the search
+  tool is asked to repeat the search (see QtxSearchTool::repeatSearch()),
+  which then uses the found items.
 */
 
 /*!
@@ -1150,8 +1187,12 @@ QtxSearchTool::Searcher::~Searcher()
   \sa setSearchColumn()
 */
 QtxTreeViewSearcher::QtxTreeViewSearcher( QTreeView* view, int col )
-  : myView( view ), myColumn( col )
+  : myView( view ), myColumn( col ),
+    myIsIndexValid( false ), myIndexStamp( 0 ),
+    myLastFlags( Qt::MatchExactly ),
+    myPool( new QThreadPool() )
 {
+  myNotifier = new Notifier( this );
 }
 
 /*!
@@ -1159,6 +1200,13 @@ QtxTreeViewSearcher::QtxTreeViewSearcher( QTreeView* view, int col )
 */
 QtxTreeViewSearcher::~QtxTreeViewSearcher()
 {
+  setModel( 0 );
+
+  // worker threads refer to the notifier
+  myPool->clear();
+  myPool->waitForDone();
+  delete myPool;
+  delete myNotifier;
 }
 
 /*!
@@ -1178,9 +1226,172 @@ int QtxTreeViewSearcher::searchColumn() const
 */
 void QtxTreeViewSearcher::setSearchColumn( int column )
 {
+  if ( myColumn == column )
+    return;
+
   myColumn = column;
+  invalidateIndex();
+}
+
+namespace
+{
+  /*!
+    \brief Minimal number of items to match regular expression in the worker threads.
+    \internal
+  */
+  const int MIN_PARALLEL_ITEMS = 10000;
+
+  /*!
+    \brief Get row numbers of the index and all its parents, starting from the top-level one.
+    \internal
+  */
+  QVector<int> rowPath( const QModelIndex& index )
+  {
+    QVector<int> path;
+    for ( QModelIndex p = index; p.isValid(); p = p.parent() )
+      path.prepend( p.row() );
+    return path;
+  }
+
+  /*!
+    \brief Compare row paths in the tree traversal order.
+    \internal
+    \return 0 if paths are equal, negative value if left path is less than right one
+    and positive value otherwise
+  */
+  int comparePaths( const QVector<int>& left, const QVector<int>& right )
+  {
+    for ( int i = 0; i < left.count() && i < right.count(); i++ )
+    {
+      if ( left[i] != right[i] )
+        return left[i] - right[i];
+    }
+    return left.count() - right.count();
+  }
+
+  /*!
+    \brief Check if text matches the searched one according to the match flags.
+    \internal
+
+    Matching follows QAbstractItemModel::match() rules for string data.
+  */
+  bool matchText( const QString& t, const QString& text, Qt::MatchFlags flags )
+  {
+    Qt::CaseSensitivity cs = flags & Qt::MatchCaseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    switch ( flags & 0x0F )
+    {
+    case Qt::MatchExactly:
+      return t == text;
+    case Qt::MatchFixedString:
+      return t.compare( text, cs ) == 0;
+    case Qt::MatchStartsWith:
+      return t.startsWith( text, cs );
+    case Qt::MatchEndsWith:
+      return t.endsWith( text, cs );
+    case Qt::MatchContains:
+    default:
+      return t.contains( text, cs );
+    }
+  }
+
+  /*!
+    \brief Match texts of the items range against the regular expression.
+    \internal
+    \param texts texts of the items
+    \param topLevel flags of top-level items; if empty, all items are checked,
+    otherwise only top-level ones
+    \param rx regular expression
+    \param from first item
+    \param to item next to the last one
+    \param found returning positions of matching items
+  */
+  void matchRange( const QVector<QString>& texts, const QVector<bool>& topLevel,
+                   const QRegExp& rx, int from, int to, QList<int>& found )
+  {
+    for ( int i = from; i < to; i++ )
+    {
+      if ( ( topLevel.isEmpty() || topLevel.at( i ) ) && rx.exactMatch( texts.at( i ) ) )
+        found.append( i );
+    }
+  }
 }
 
+/*!
+  \brief Regular expression matching request performed in the worker threads.
+  \internal
+*/
+struct QtxTreeViewSearcher::MatchRequest
+{
+  QString                 text;      //!< searched text
+  Qt::MatchFlags          flags;     //!< match flags
+  int                     stamp;     //!< state of the index the texts are taken from
+  QVector<QString>        texts;     //!< texts of the items (shared with the index)
+  QVector<bool>           topLevel;  //!< top-level items flags (empty for recursive search)
+  QVector< QList<int> >   parts;     //!< positions of the found items, per task
+  QAtomicInt              remaining; //!< number of tasks still running
+  QPointer<QtxSearchTool> tool;      //!< search tool waiting for the result
+};
+
+/*!
+  \brief Object receiving notifications from the worker threads in the GUI thread.
+  \internal
+*/
+class QtxTreeViewSearcher::Notifier : public QObject
+{
+public:
+  //! Event posted when all tasks of the request are finished
+  class Event : public QEvent
+  {
+  public:
+    Event( const QSharedPointer<MatchRequest>& request ) : QEvent( QEvent::User ), myRequest( request ) {}
+    QSharedPointer<MatchRequest> request() const { return myRequest; }
+  private:
+    QSharedPointer<MatchRequest> myRequest;
+  };
+
+  Notifier( QtxTreeViewSearcher* searcher ) : mySearcher( searcher ) {}
+
+  virtual bool event( QEvent* e )
+  {
+    if ( e->type() != QEvent::User )
+      return QObject::event( e );
+    mySearcher->matchFinished( static_cast<Event*>( e )->request() );
+    return true;
+  }
+
+private:
+  QtxTreeViewSearcher* mySearcher;
+};
+
+/*!
+  \brief Task which matches texts of items range against the regular expression.
+  \internal
+*/
+class QtxTreeViewSearcher::MatchTask : public QRunnable
+{
+public:
+  MatchTask( const QSharedPointer<MatchRequest>& request, QList<int>* result, int from, int to,
+             const QRegExp& rx, Notifier* notifier )
+    : myRequest( request ), myResult( result ), myFrom( from ), myTo( to ), myRx( rx ), myNotifier( notifier ) {}
+
+  virtual void run()
+  {
+    // request is only read here: non-const QVector methods may detach the shared data
+    const MatchRequest& request = *myRequest;
+    matchRange( request.texts, request.topLevel, myRx, myFrom, myTo, *myResult );
+    if ( !myRequest->remaining.deref() )
+      QApplication::postEvent( myNotifier, new Notifier::Event( myRequest ) );
+  }
+
+private:
+  QSharedPointer<MatchRequest> myRequest;
+  QList<int>*                  myResult;   // own slot of the request parts, allocated before start
+  int                          myFrom;
+  int                          myTo;
+  QRegExp                      myRx;       // copy: QRegExp is not thread-safe
+  Notifier*                    myNotifier;
+};
+
 /*!
   \brief Start new search.
   \param text text to be found
@@ -1201,32 +1412,37 @@ bool QtxTreeViewSearcher::find( const QString& text, QtxSearchTool* st )
 
   bool wrapSearch = st->isSearchWrapped();
 
-  QModelIndexList found = findItems( text, st );
+  bool pending = false;
+  QList<int> found = findItems( text, st, pending );
+  if ( pending )
+    return true;  // search will be repeated when the result is ready
 
   if ( found.count() > 0 )
   {
     if ( !current.isValid() )
     {
-      showItem( found.first() );
+      showItem( myItems[found.first()] );
       return true;
     }
 
-    if ( found.contains( current ) )
+    int pos = itemPosition( current );
+    if ( pos < myItems.count() && compareIndices( myItems[pos], current ) == 0 &&
+         std::binary_search( found.begin(), found.end(), pos ) )
     {
       showItem( current );
       return true;
     }
 
-    QModelIndex next = findNearest( current, found, true );
-    if ( next.isValid() )
+    int next = findNearest( current, found, true );
+    if ( next >= 0 )
     {
-      showItem( next );
+      showItem( myItems[next] );
       return true;
     }
 
     if ( wrapSearch )
     {
-      showItem( found.first() );
+      showItem( myItems[found.first()] );
       return true;
     }
   }
@@ -1256,26 +1472,29 @@ bool QtxTreeViewSearcher::findNext( const QString& text, QtxSearchTool* st )
 
   bool wrapSearch = st->isSearchWrapped();
 
-  QModelIndexList found = findItems( text, st );
+  bool pending = false;
+  QList<int> found = findItems( text, st, pending );
+  if ( pending )
+    return true;  // search will be repeated when the result is ready
 
   if ( found.count() > 0 )
   {
     if ( !current.isValid() )
     {
-      showItem( found.first() );
+      showItem( myItems[found.first()] );
       return true;
     }
 
-    QModelIndex next = findNearest( current, found, true );
-    if ( next.isValid() )
+    int next = findNearest( current, found, true );
+    if ( next >= 0 )
     {
-      showItem( next );
+      showItem( myItems[next] );
       return true;
     }
 
     if ( wrapSearch )
     {
-      showItem( found.first() );
+      showItem( myItems[found.first()] );
       return true;
     }
   }
@@ -1305,26 +1524,29 @@ bool QtxTreeViewSearcher::findPrevious( const QString& text, QtxSearchTool* st )
 
   bool wrapSearch = st->isSearchWrapped();
 
-  QModelIndexList found = findItems( text, st );
+  bool pending = false;
+  QList<int> found = findItems( text, st, pending );
+  if ( pending )
+    return true;  // search will be repeated when the result is ready
 
   if ( found.count() > 0 )
   {
     if ( !current.isValid() )
     {
-      showItem( found.first() );
+      showItem( myItems[found.first()] );
       return true;
     }
 
-    QModelIndex next = findNearest( current, found, false );
-    if ( next.isValid() )
+    int next = findNearest( current, found, false );
+    if ( next >= 0 )
     {
-      showItem( next );
+      showItem( myItems[next] );
       return true;
     }
 
     if ( wrapSearch )
     {
-      showItem( found.last() );
+      showItem( myItems[found.last()] );
       return true;
     }
   }
@@ -1340,11 +1562,14 @@ bool QtxTreeViewSearcher::findPrevious( const QString& text, QtxSearchTool* st )
 */
 bool QtxTreeViewSearcher::findFirst( const QString& text, QtxSearchTool* st )
 {
-  QModelIndexList found = findItems( text, st );
+  bool pending = false;
+  QList<int> found = findItems( text, st, pending );
+  if ( pending )
+    return true;  // search will be repeated when the result is ready
 
   if ( found.count() > 0 )
   {
-    showItem( found.first() );
+    showItem( myItems[found.first()] );
     return true;
   }
 
@@ -1359,11 +1584,14 @@ bool QtxTreeViewSearcher::findFirst( const QString& text, QtxSearchTool* st )
 */
 bool QtxTreeViewSearcher::findLast( const QString& text, QtxSearchTool* st )
 {
-  QModelIndexList found = findItems( text, st );
+  bool pending = false;
+  QList<int> found = findItems( text, st, pending );
+  if ( pending )
+    return true;  // search will be repeated when the result is ready
 
   if ( found.count() > 0 )
   {
-    showItem( found.last() );
+    showItem( myItems[found.last()] );
     return true;
   }
 
@@ -1390,63 +1618,192 @@ Qt::MatchFlags QtxTreeViewSearcher::matchFlags( QtxSearchTool* st ) const
 
 /*!
   \brief Find all appropriate items.
+
+  For large models regular expressions are matched in the worker threads:
+  in this case \a pending is set to \c true and an empty list is returned;
+  the search tool is asked to repeat the search when the result is ready.
+
   \internal
   \param text text to be found
   \param st search tool widget
+  \param pending returns \c true if the result is not ready yet
+  \return positions of the found items in the index, in ascending order
 */
-QModelIndexList QtxTreeViewSearcher::findItems( const QString& text, QtxSearchTool* st )
+QList<int> QtxTreeViewSearcher::findItems( const QString& text, QtxSearchTool* st, bool& pending )
 {
-  QString s = text;
+  updateIndex();
+
+  pending = false;
+
+  QList<int> found;
+  if ( !myModel )
+    return found;
 
   Qt::MatchFlags fl = matchFlags( st );
-  if ( fl & Qt::MatchRegExp ) {
-    if ( !s.startsWith( "^" ) && !s.startsWith( ".*" ) )
-      s.prepend( ".*" );
-    if ( !s.endsWith( "$" ) && !s.endsWith( ".*" ) )
-      s.append( ".*" );
+  int matchType = fl & 0x0F;
+
+  // without Qt::MatchRecursive flag only top-level items are checked, as by QAbstractItemModel::match()
+  bool recursive = fl & Qt::MatchRecursive;
+
+  // search is repeated (e.g. 'find next'): items found before are still valid
+  if ( !myLastText.isNull() && myLastText == text && myLastFlags == fl )
+    return myLastFound;
+
+  if ( matchType == Qt::MatchRegExp || matchType == Qt::MatchWildcard )
+  {
+    QString s = text;
+    if ( matchType == Qt::MatchRegExp ) {
+      if ( !s.startsWith( "^" ) && !s.startsWith( ".*" ) )
+        s.prepend( ".*" );
+      if ( !s.endsWith( "$" ) && !s.endsWith( ".*" ) )
+        s.append( ".*" );
+    }
+
+    QRegExp rx( s, fl & Qt::MatchCaseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive,
+                matchType == Qt::MatchRegExp ? QRegExp::RegExp : QRegExp::Wildcard );
+
+    if ( myItems.count() >= MIN_PARALLEL_ITEMS )
+    {
+      if ( !myRequest || myRequest->text != text || myRequest->flags != fl || myRequest->stamp != myIndexStamp )
+        startMatch( text, fl, rx, st );
+      else
+        myRequest->tool = st;
+      pending = true;
+      return found;
+    }
+
+    matchRange( myTexts, recursive ? QVector<bool>() : myTopLevel, rx, 0, myTexts.count(), found );
+  }
+  else
+  {
+    Qt::CaseSensitivity cs = fl & Qt::MatchCaseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    bool refine = !myLastText.isNull() && myLastFlags == fl && text.contains( myLastText, cs ) &&
+      ( matchType == Qt::MatchContains ||
+        ( matchType == Qt::MatchStartsWith && text.startsWith( myLastText, cs ) ) ||
+        ( matchType == Qt::MatchEndsWith && text.endsWith( myLastText, cs ) ) );
+    if ( refine )
+    {
+      // the searched text is extended: only items found before can match
+      for ( QList<int>::const_iterator it = myLastFound.begin(); it != myLastFound.end(); ++it )
+      {
+        if ( matchText( myTexts.at( *it ), text, fl ) )
+          found.append( *it );
+      }
+    }
+    else
+    {
+      for ( int i = 0; i < myTexts.count(); i++ )
+      {
+        if ( ( recursive || myTopLevel.at( i ) ) && matchText( myTexts.at( i ), text, fl ) )
+          found.append( i );
+      }
+    }
   }
 
-  if ( myView->model() )
-    return myView->model()->match( myView->model()->index( 0, myColumn ),
-                                   Qt::DisplayRole,
-                                   s, -1, fl );
-  return QModelIndexList();
+  myLastText = text;
+  myLastFlags = fl;
+  myLastFound = found;
+
+  return found;
 }
 
 /*!
-  \brief Find model index from the list nearest to the specified index.
+  \brief Start matching of the regular expression in the worker threads.
+  \internal
+  \param text searched text
+  \param fl match flags
+  \param rx regular expression
+  \param st search tool widget to be notified when the result is ready
+*/
+void QtxTreeViewSearcher::startMatch( const QString& text, Qt::MatchFlags fl,
+                                      const QRegExp& rx, QtxSearchTool* st )
+{
+  // tasks of the previous request, which are not started yet, are not needed any more
+  myPool->clear();
+
+  QSharedPointer<MatchRequest> request( new MatchRequest() );
+  request->text = text;
+  request->flags = fl;
+  request->stamp = myIndexStamp;
+  request->texts = myTexts;
+  if ( !( fl & Qt::MatchRecursive ) )
+    request->topLevel = myTopLevel;
+  request->tool = st;
+
+  int nbTasks = qMax( 1, myPool->maxThreadCount() );
+  int chunk = ( request->texts.count() + nbTasks - 1 ) / nbTasks;
+  request->parts.resize( nbTasks );
+  request->remaining.store( nbTasks );
+
+  // each task writes to its own slot only; pointers are taken in the GUI thread
+  QList<int>* parts = request->parts.data();
+
+  myRequest = request;
+  for ( int i = 0; i < nbTasks; i++ )
+    myPool->start( new MatchTask( request, parts + i, qMin( i * chunk, request->texts.count() ),
+                                  qMin( ( i + 1 ) * chunk, request->texts.count() ), rx, myNotifier ) );
+}
+
+/*!
+  \brief Called in the GUI thread when regular expression matching is finished.
+  \internal
+  \param request finished request
+*/
+void QtxTreeViewSearcher::matchFinished( const QSharedPointer<MatchRequest>& request )
+{
+  // request has been superseded by another one
+  if ( request != myRequest )
+    return;
+
+  myRequest.clear();
+
+  // if items have been changed meanwhile, repeated search starts new matching
+  if ( request->stamp == myIndexStamp )
+  {
+    QList<int> found;
+    for ( int i = 0; i < request->parts.count(); i++ )
+      found += request->parts[i];
+
+    myLastText = request->text;
+    myLastFlags = request->flags;
+    myLastFound = found;
+  }
+
+  if ( request->tool )
+    request->tool->repeatSearch();
+}
+
+/*!
+  \brief Find item from the list nearest to the specified index.
   \internal
   \param index model index for which a nearest item is searched
-  \param lst list of model indices
+  \param lst positions of the items in the index, in ascending order
   \param direction if \c true find next appropriate item, otherwise find privious
   appropriate item
+  \return position of the found item or -1 if there is no appropriate item
 */
-QModelIndex QtxTreeViewSearcher::findNearest( const QModelIndex& index,
-                                              const QModelIndexList& lst,
-                                              bool direction )
+int QtxTreeViewSearcher::findNearest( const QModelIndex& index,
+                                      const QList<int>& lst,
+                                      bool direction )
 {
+  // position of the first item which is not less than the index
+  int pos = itemPosition( index );
+
   if ( direction )
   {
-    QListIterator<QModelIndex> it( lst );
-    while ( it.hasNext() )
-    {
-      QModelIndex found = it.next();
-      if ( compareIndices( found, index ) > 0 )
-        return found;
-    }
+    bool exists = pos < myItems.count() && compareIndices( myItems[pos], index ) == 0;
+    QList<int>::const_iterator it = exists ? std::upper_bound( lst.begin(), lst.end(), pos ) :
+                                             std::lower_bound( lst.begin(), lst.end(), pos );
+    if ( it != lst.end() )
+      return *it;
   }
   else
   {
-    QListIterator<QModelIndex> it( lst );
-    it.toBack();
-    while ( it.hasPrevious() )
-    {
-      QModelIndex found = it.previous();
-      if ( compareIndices( found, index ) < 0 )
-        return found;
-    }
+    QList<int>::const_iterator it = std::lower_bound( lst.begin(), lst.end(), pos );
+    if ( it != lst.begin() )
+      return *( --it );
   }
-  return QModelIndex();
+  return -1;
 }
 
 /*!
@@ -1467,48 +1824,285 @@ void QtxTreeViewSearcher::showItem( const QModelIndex& index )
 }
 
 /*!
-  \brief Get unique item ID.
+  \brief Compare items.
+  \internal
+  \param left first model index to be compared
+  \param right last model index to be compared
+  \return 0 if items are equal, negative value if left item is less than right one
+  and positive value otherwise
+*/
+int QtxTreeViewSearcher::compareIndices( const QModelIndex& left,
+                                         const QModelIndex& right )
+{
+  return comparePaths( rowPath( left ), rowPath( right ) );
+}
+
+/*!
+  \brief Set model to be indexed.
+  \internal
+  \param model model (can be 0)
+*/
+void QtxTreeViewSearcher::setModel( QAbstractItemModel* model )
+{
+  for ( QList<QMetaObject::Connection>::const_iterator it = myConnections.begin(); it != myConnections.end(); ++it )
+    QObject::disconnect( *it );
+  myConnections.clear();
+
+  myModel = model;
+  invalidateIndex();
+
+  if ( !model )
+    return;
+
+  // rows changes update only the affected part of the built index; other structure
+  // changes just mark the index as out of date, to be rebuilt once on next search
+  myConnections << QObject::connect( model, &QAbstractItemModel::rowsInserted,
+                                     [this]( const QModelIndex& p, int first, int last ) { onRowsInserted( p, first, last ); } );
+  myConnections << QObject::connect( model, &QAbstractItemModel::rowsAboutToBeRemoved,
+                                     [this]( const QModelIndex& p, int first, int last ) { onRowsAboutToBeRemoved( p, first, last ); } );
+  myConnections << QObject::connect( model, &QAbstractItemModel::dataChanged,
+                                     [this]( const QModelIndex& tl, const QModelIndex& br, const QVector<int>& roles ) { onDataChanged( tl, br, roles ); } );
+  myConnections << QObject::connect( model, &QAbstractItemModel::rowsAboutToBeMoved,
+                                     [this]( const QModelIndex& sp, int first, int last, const QModelIndex& dp, int row ) { onRowsAboutToBeMoved( sp, first, last, dp, row ); } );
+  myConnections << QObject::connect( model, &QAbstractItemModel::columnsInserted, [this]() { invalidateIndex(); } );
+  myConnections << QObject::connect( model, &QAbstractItemModel::columnsRemoved, [this]() { invalidateIndex(); } );
+  myConnections << QObject::connect( model, &QAbstractItemModel::columnsMoved, [this]() { invalidateIndex(); } );
+  myConnections << QObject::connect( model, &QAbstractItemModel::layoutChanged, [this]() { invalidateIndex(); } );
+  myConnections << QObject::connect( model, &QAbstractItemModel::modelReset,   [this]() { invalidateIndex(); } );
+}
+
+/*!
+  \brief Build the index of items if it is invalid.
+  \internal
+*/
+void QtxTreeViewSearcher::updateIndex()
+{
+  QAbstractItemModel* model = myView ? myView->model() : 0;
+  if ( model != myModel )
+    setModel( model );
+
+  if ( myIsIndexValid || !myModel )
+    return;
+
+  myItems.clear();
+  myTexts.clear();
+  myTopLevel.clear();
+  collectItems( QModelIndex(), 0, myModel->rowCount() - 1 );
+  myIsIndexValid = true;
+}
+
+/*!
+  \brief Mark the index of items as invalid; it will be rebuilt on next search.
+  \internal
+*/
+void QtxTreeViewSearcher::invalidateIndex()
+{
+  myIsIndexValid = false;
+  myIndexStamp++;
+  myItems.clear();
+  myTexts.clear();
+  myTopLevel.clear();
+  myLastText = QString();
+  myLastFound.clear();
+}
+
+/*!
+  \brief Collect the specified rows of the parent item and all their children
+  in the tree traversal order to the index.
+  \internal
+  \param parent parent model index
+  \param first first row
+  \param last last row
+*/
+void QtxTreeViewSearcher::collectItems( const QModelIndex& parent, int first, int last )
+{
+  for ( int r = first; r <= last; r++ )
+  {
+    QModelIndex index = myModel->index( r, myColumn, parent );
+    if ( index.isValid() )
+    {
+      myItems.append( index );
+      myTexts.append( index.data( Qt::DisplayRole ).toString() );
+      myTopLevel.append( !parent.isValid() );
+    }
+
+    QModelIndex p = myModel->index( r, 0, parent );
+    if ( myModel->hasChildren( p ) )
+      collectItems( p, 0, myModel->rowCount( p ) - 1 );
+  }
+}
+
+/*!
+  \brief Get position of the item in the index.
   \internal
   \param index model index
-  \return item ID
+  \return position of the first item which is not less than \a index
+*/
+int QtxTreeViewSearcher::itemPosition( const QModelIndex& index ) const
+{
+  return pathPosition( rowPath( index ) );
+}
+
+/*!
+  \brief Get position of the item with given row path in the index.
+  \internal
+  \param path row numbers of the item and all its parents, starting from the top-level one
+  \return position of the first item which is not less than \a path
 */
-QString QtxTreeViewSearcher::getId( const QModelIndex& index )
+int QtxTreeViewSearcher::pathPosition( const QVector<int>& path ) const
 {
-  QStringList ids;
-  QModelIndex p = index;
-  while ( p.isValid() )
+  int lo = 0, hi = myItems.count();
+  while ( lo < hi )
   {
-    ids.prepend( QString::number( p.row() ) );
-    p = p.parent();
+    int mid = ( lo + hi ) / 2;
+    if ( comparePaths( rowPath( myItems[mid] ), path ) < 0 )
+      lo = mid + 1;
+    else
+      hi = mid;
   }
-  ids.prepend( "0" );
-  return ids.join( ":" );
+  return lo;
 }
 
 /*!
-  \brief Compare items.
+  \brief Called when data of the model items is changed.
   \internal
-  \param left first model index to be compared
-  \param right last model index to be compared
-  \return 0 if items are equal, negative value if left item is less than right one
-  and positive value otherwise
 */
-int QtxTreeViewSearcher::compareIndices( const QModelIndex& left,
-                                         const QModelIndex& right )
+void QtxTreeViewSearcher::onDataChanged( const QModelIndex& topLeft, const QModelIndex& bottomRight,
+                                         const QVector<int>& roles )
 {
-  QString leftId = getId( left );
-  QString rightId = getId( right );
+  if ( !myIsIndexValid )
+    return;
+
+  if ( !roles.isEmpty() && !roles.contains( Qt::DisplayRole ) )
+    return;
 
-  QStringList idsLeft  = leftId.split( ":", QString::SkipEmptyParts );
-  QStringList idsRight = rightId.split( ":", QString::SkipEmptyParts );
+  if ( myColumn < topLeft.column() || myColumn > bottomRight.column() )
+    return;
 
-  for ( int i = 0; i < idsLeft.count() && i < idsRight.count(); i++ )
+  for ( int r = topLeft.row(); r <= bottomRight.row(); r++ )
   {
-    int lid = idsLeft[i].toInt();
-    int rid = idsRight[i].toInt();
-    if ( lid != rid )
-      return lid - rid;
+    QModelIndex index = myModel->index( r, myColumn, topLeft.parent() );
+    if ( !index.isValid() )
+      continue;
+    int pos = itemPosition( index );
+    if ( pos < myItems.count() && compareIndices( myItems[pos], index ) == 0 )
+      myTexts[pos] = index.data( Qt::DisplayRole ).toString();
   }
-  return idsLeft.count() < idsRight.count() ? -1 :
-    ( idsLeft.count() == idsRight.count() ? 0 : 1 );
+
+  updateStamp();
+}
+
+/*!
+  \brief Mark the indexed items as changed: results of the previous searches are not valid any more.
+  \internal
+*/
+void QtxTreeViewSearcher::updateStamp()
+{
+  myIndexStamp++;
+  myLastText = QString();
+  myLastFound.clear();
+}
+
+/*!
+  \brief Called when rows are inserted to the model.
+
+  Inserted rows and their children are added to the index; items kept
+  in the index follow their rows, as they are persistent.
+
+  \internal
+*/
+void QtxTreeViewSearcher::onRowsInserted( const QModelIndex& parent, int first, int last )
+{
+  if ( !myIsIndexValid )
+    return;
+
+  // rows next to the inserted ones are already shifted, so the position is the insertion point
+  QVector<int> path = rowPath( parent );
+  path.append( first );
+  int pos = pathPosition( path );
+
+  // new items are collected to the end, then moved to their position
+  int count = myItems.count();
+  collectItems( parent, first, last );
+  std::rotate( myItems.begin() + pos, myItems.begin() + count, myItems.end() );
+  std::rotate( myTexts.begin() + pos, myTexts.begin() + count, myTexts.end() );
+  std::rotate( myTopLevel.begin() + pos, myTopLevel.begin() + count, myTopLevel.end() );
+
+  updateStamp();
+}
+
+/*!
+  \brief Called when rows are about to be removed from the model.
+
+  Rows and their children are removed from the index while their indices are still valid.
+
+  \internal
+*/
+void QtxTreeViewSearcher::onRowsAboutToBeRemoved( const QModelIndex& parent, int first, int last )
+{
+  if ( !myIsIndexValid )
+    return;
+
+  QVector<int> path = rowPath( parent );
+  path.append( first );
+  int from = pathPosition( path );
+  path.last() = last + 1;
+  int to = pathPosition( path );
+
+  myItems.remove( from, to - from );
+  myTexts.remove( from, to - from );
+  myTopLevel.remove( from, to - from );
+
+  updateStamp();
+}
+
+/*!
+  \brief Called when rows are about to be moved in the model.
+
+  Items of the moved rows and their children are moved in the index to the
+  destination position; the model then updates their persistent indices.
+
+  \internal
+*/
+void QtxTreeViewSearcher::onRowsAboutToBeMoved( const QModelIndex& srcParent, int first, int last,
+                                                const QModelIndex& dstParent, int row )
+{
+  if ( !myIsIndexValid )
+    return;
+
+  QVector<int> srcPath = rowPath( srcParent );
+  srcPath.append( first );
+  int from = pathPosition( srcPath );
+  srcPath.last() = last + 1;
+  int to = pathPosition( srcPath );
+
+  QVector<int> dstPath = rowPath( dstParent );
+  dstPath.append( row );
+  int pos = pathPosition( dstPath );
+
+  // items of the moved rows themselves (not their children) change their parent
+  if ( srcParent.isValid() != dstParent.isValid() )
+  {
+    for ( int i = from; i < to; i++ )
+    {
+      if ( rowPath( myItems[i] ).count() == srcPath.count() )
+        myTopLevel[i] = !dstParent.isValid();
+    }
+  }
+
+  // destination can not be inside the moved rows
+  if ( pos < from )
+  {
+    std::rotate( myItems.begin() + pos, myItems.begin() + from, myItems.begin() + to );
+    std::rotate( myTexts.begin() + pos, myTexts.begin() + from, myTexts.begin() + to );
+    std::rotate( myTopLevel.begin() + pos, myTopLevel.begin() + from, myTopLevel.begin() + to );
+  }
+  else if ( pos > to )
+  {
+    std::rotate( myItems.begin() + from, myItems.begin() + to, myItems.begin() + pos );
+    std::rotate( myTexts.begin() + from, myTexts.begin() + to, myTexts.begin() + pos );
+    std::rotate( myTopLevel.begin() + from, myTopLevel.begin() + to, myTopLevel.begin() + pos );
+  }
+
+  updateStamp();
 }
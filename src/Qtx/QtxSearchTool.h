@@ -29,10 +29,15 @@
 #include <QMap>
 #include <QPersistentModelIndex>
 #include <QPointer>
+#include <QSharedPointer>
+#include <QVector>
 
+class QAbstractItemModel;
 class QCheckBox;
 class QLineEdit;
+class QRegExp;
 class QShortcut;
+class QThreadPool;
 class QTimer;
 class QToolButton;
 class QTreeView;
@@ -124,6 +129,8 @@ public slots:
   virtual void        findFirst();
   virtual void        findLast();
 
+  void                repeatSearch();
+
 private slots:
   void                find( const QString&, int = fAny );
   void                modifierSwitched();
@@ -160,6 +167,7 @@ private:
   QTimer*             myAutoHideTimer;
   bool                myAutoHideEnabled;
   QMap<int, QWidget*> myWidgets;
+  int                 myLastSearch;
 };
 
 class QTX_EXPORT QtxSearchTool::Searcher
@@ -194,16 +202,50 @@ protected:
   virtual Qt::MatchFlags matchFlags( QtxSearchTool* ) const;
   
 private:
-  QModelIndexList        findItems( const QString&, QtxSearchTool* );
-  QModelIndex            findNearest( const QModelIndex&, const QModelIndexList&, bool );
+  class Notifier;
+  class MatchTask;
+  struct MatchRequest;
+
+  QList<int>             findItems( const QString&, QtxSearchTool*, bool& );
+  void                   startMatch( const QString&, Qt::MatchFlags, const QRegExp&, QtxSearchTool* );
+  void                   matchFinished( const QSharedPointer<MatchRequest>& );
+  int                    findNearest( const QModelIndex&, const QList<int>&, bool );
   void                   showItem( const QModelIndex& );
-  QString                getId( const QModelIndex& );
   int                    compareIndices( const QModelIndex&, const QModelIndex& );
 
+  void                   setModel( QAbstractItemModel* );
+  void                   updateIndex();
+  void                   invalidateIndex();
+  void                   collectItems( const QModelIndex&, int, int );
+  int                    itemPosition( const QModelIndex& ) const;
+  int                    pathPosition( const QVector<int>& ) const;
+  void                   updateStamp();
+
+  void                   onDataChanged( const QModelIndex&, const QModelIndex&, const QVector<int>& );
+  void                   onRowsInserted( const QModelIndex&, int, int );
+  void                   onRowsAboutToBeRemoved( const QModelIndex&, int, int );
+  void                   onRowsAboutToBeMoved( const QModelIndex&, int, int, const QModelIndex&, int );
+
 private:
-  QTreeView*             myView;
-  int                    myColumn;
-  QPersistentModelIndex  myIndex;
+  QTreeView*                     myView;
+  int                            myColumn;
+  QPersistentModelIndex          myIndex;
+
+  QPointer<QAbstractItemModel>   myModel;         //!< model being indexed
+  QList<QMetaObject::Connection> myConnections;   //!< connections to the model signals
+  bool                           myIsIndexValid;  //!< \c false if index should be rebuilt
+  QVector<QPersistentModelIndex> myItems;         //!< items in the tree traversal order
+  QVector<QString>               myTexts;         //!< cached texts of the items
+  QVector<bool>                  myTopLevel;      //!< \c true for top-level items
+  int                            myIndexStamp;    //!< changed each time the indexed texts are changed
+
+  QString                        myLastText;      //!< last searched text
+  Qt::MatchFlags                 myLastFlags;     //!< last used match flags
+  QList<int>                     myLastFound;     //!< positions of items found by last search
+
+  QThreadPool*                   myPool;          //!< threads for regular expression matching
+  Notifier*                      myNotifier;      //!< receives results of the worker threads
+  QSharedPointer<MatchRequest>   myRequest;       //!< regular expression matching in progress
 };
 
 #endif // QTXSEARCHTOOL_H
@@ -509,6 +509,260 @@ bool QtxWorkstackSplitter::restoreState( QDataStream& stream, QMap<QString, QtxW
   return ok;
 }
 
+/*!
+  \brief Read the stored splitter or area configuration from data stream
+  without applying it.
+  \internal
+  \param stream data stream, positioned after the marker
+  \param marker marker of the configuration (QtxWorkstack::SplitMarker or QtxWorkstack::AreaMarker)
+  \param names returning names of the stored widgets
+  \return \c true if configuration has been read successfully
+*/
+static bool readState( QDataStream& stream, const int marker, QStringList& names )
+{
+  if ( marker == QtxWorkstack::SplitMarker )
+  {
+    int num = 0;
+    uchar flags = 0;
+    stream >> flags;
+    stream >> num;
+    for ( int s = 0; s < num; s++ )
+    {
+      int sn = 0;
+      stream >> sn;
+    }
+
+    for ( int i = 0; i < num && stream.status() == QDataStream::Ok; i++ )
+    {
+      int m;
+      stream >> m;
+      if ( !readState( stream, m, names ) )
+        return false;
+    }
+  }
+  else if ( marker == QtxWorkstack::AreaMarker )
+  {
+    int num = 0;
+    int cur = -1;
+    stream >> num;
+    stream >> cur;
+    for ( int i = 0; i < num && stream.status() == QDataStream::Ok; i++ )
+    {
+      int m;
+      stream >> m;
+      if ( m != QtxWorkstack::WidgetMarker )
+        return false;
+
+      QString name;
+      int id = -1;
+      uchar flags = 0;
+      stream >> name >> id >> flags;
+      names.append( name );
+    }
+  }
+  else
+    return false;
+
+  return stream.status() == QDataStream::Ok;
+}
+
+/*!
+  \brief Collect the children of all areas of the splitter or area.
+  \internal
+  \param wid splitter or area
+  \param map returning children, mapped by names of their widgets
+*/
+static void collectChildren( QWidget* wid, QMap<QString, QtxWorkstackChild*>& map )
+{
+  if ( QtxWorkstackArea* area = ::qobject_cast<QtxWorkstackArea*>( wid ) )
+  {
+    QList<QtxWorkstackChild*> childList = area->childList();
+    for ( QList<QtxWorkstackChild*>::const_iterator it = childList.begin(); it != childList.end(); ++it )
+    {
+      if ( (*it)->widget() )
+        map.insert( (*it)->widget()->objectName(), *it );
+    }
+  }
+  else if ( QSplitter* split = ::qobject_cast<QSplitter*>( wid ) )
+  {
+    for ( int i = 0; i < split->count(); i++ )
+      collectChildren( split->widget( i ), map );
+  }
+}
+
+/*!
+  \brief Compare the widget area configuration from data stream info with
+  the current one and, optionally, apply it reusing existing splitters and areas.
+
+  Stored items are compared with the existing ones at the same position first,
+  then with other existing items of the splitter which are not used yet.
+  The splitter is kept for the stored splitter: its orientation and sizes are
+  applied and its items are compared in turn. The area is kept if it contains
+  the same widgets in the same order: visibility of the widgets and the current
+  widget are applied. Other items are re-created from the stream; their widgets
+  are moved from the existing items which are not used.
+
+  The check (\a apply is \c false) collects the children of the items to be
+  replaced and the names of widgets of the items to be re-created, so that
+  the configuration can be verified before anything is changed. The data stream
+  device must be random-access.
+
+  \param stream data stream
+  \param map children of the items to be replaced; when applying, children
+  moved to the re-created areas are removed from the map
+  \param names names of widgets of the items to be re-created (collected by the check)
+  \param removed replaced items, to be deleted when restoring is finished (collected when applying)
+  \param apply if \c true the configuration is applied, otherwise the stream is only checked
+  \return \c true if the stream contains a valid configuration
+*/
+bool QtxWorkstackSplitter::reconcileState( QDataStream& stream, QMap<QString, QtxWorkstackChild*>& map,
+                                           QStringList& names, QWidgetList& removed, const bool apply )
+{
+  QIODevice* dev = stream.device();
+
+  int num = 0;
+  uchar flags = 0;
+
+  stream >> flags;
+  stream >> num;
+
+  if ( stream.status() != QDataStream::Ok || num < 0 )
+    return false;
+
+  QList<int> sz;
+  for ( int s = 0; s < num; s++ )
+  {
+    int sn = 0;
+    stream >> sn;
+    sz.append( sn );
+  }
+
+  Qt::Orientation o = flags & QtxWorkstack::Horizontal ? Qt::Horizontal : Qt::Vertical;
+  if ( apply && orientation() != o )
+    setOrientation( o );
+
+  QWidgetList old;
+  for ( int i = 0; i < count(); i++ )
+    old.append( widget( i ) );
+
+  QWidgetList result;
+  for ( int i = 0; i < num; i++ )
+  {
+    int marker;
+    stream >> marker;
+
+    if ( stream.status() != QDataStream::Ok )
+      return false;
+
+    // existing item at the same position is tried first, then other ones
+    // which are not used yet (e.g. when an item has been inserted before)
+    QWidgetList candidates;
+    if ( i < old.count() && !result.contains( old.at( i ) ) )
+      candidates.append( old.at( i ) );
+    for ( QWidgetList::const_iterator it = old.begin(); it != old.end(); ++it )
+    {
+      if ( !result.contains( *it ) && !candidates.contains( *it ) )
+        candidates.append( *it );
+    }
+
+    QWidget* found = 0;
+    qint64 pos = dev->pos();
+    for ( QWidgetList::const_iterator it = candidates.begin(); it != candidates.end() && !found; ++it )
+    {
+      if ( marker == QtxWorkstack::SplitMarker )
+      {
+        QtxWorkstackSplitter* split = ::qobject_cast<QtxWorkstackSplitter*>( *it );
+        if ( !split )
+          continue;
+        if ( !split->reconcileState( stream, map, names, removed, apply ) )
+          return false;
+        found = split;
+      }
+      else if ( QtxWorkstackArea* area = ::qobject_cast<QtxWorkstackArea*>( *it ) )
+      {
+        if ( area->reconcileState( stream, false ) )
+        {
+          if ( apply )
+          {
+            dev->seek( pos );
+            area->reconcileState( stream, true );
+          }
+          found = area;
+        }
+        else
+        {
+          dev->seek( pos );
+          stream.resetStatus();
+        }
+      }
+    }
+
+    if ( found )
+    {
+      result.append( found );
+      continue;
+    }
+
+    // there is no such item: it is re-created
+    if ( !apply )
+    {
+      if ( !readState( stream, marker, names ) )
+        return false;
+      continue;
+    }
+
+    if ( marker == QtxWorkstack::SplitMarker )
+    {
+      QtxWorkstackSplitter* newSplit = new QtxWorkstackSplitter( this );
+      addWidget( newSplit );
+      newSplit->setVisible( true );
+      if ( !newSplit->restoreState( stream, map ) )
+        return false;
+      result.append( newSplit );
+    }
+    else
+    {
+      QtxWorkstackArea* newArea = workstack()->createArea( this );
+      addWidget( newArea );
+      newArea->setVisible( true );
+      if ( !newArea->restoreState( stream, map ) )
+        return false;
+      result.append( newArea );
+    }
+  }
+
+  if ( !apply )
+  {
+    for ( QWidgetList::const_iterator it = old.begin(); it != old.end(); ++it )
+    {
+      if ( !result.contains( *it ) )
+        collectChildren( *it, map );
+    }
+    return true;
+  }
+
+  for ( int i = 0; i < result.count(); i++ )
+  {
+    if ( indexOf( result.at( i ) ) != i )
+      insertWidget( i, result.at( i ) );
+  }
+
+  // replaced items are taken out of the layout, they are deleted
+  // after their widgets are moved to the re-created areas
+  for ( QWidgetList::const_iterator it = old.begin(); it != old.end(); ++it )
+  {
+    if ( result.contains( *it ) )
+      continue;
+    (*it)->setParent( workstack() );
+    removed.append( *it );
+  }
+
+  if ( sizes() != sz )
+    setSizes( sz );
+
+  return true;
+}
+
 /*!
   \class QtxWorkstackArea
   \internal
@@ -902,6 +1156,60 @@ bool QtxWorkstackArea::restoreState( QDataStream& stream, QMap<QString, QtxWorks
   return true;
 }
 
+/*!
+  \brief Compare the widgets configuration from data stream info with
+  the current one and, optionally, apply the differences in place.
+  \param stream data stream
+  \param apply if \c true the differences are applied, otherwise the stream is only checked
+  \return \c true if the area contains the same widgets in the same order
+*/
+bool QtxWorkstackArea::reconcileState( QDataStream& stream, const bool apply )
+{
+  int num = 0;
+  int cur = -1;
+
+  stream >> num;
+  stream >> cur;
+
+  if ( stream.status() != QDataStream::Ok || num != myList.count() )
+    return false;
+
+  QtxWorkstackChild* curChild = 0;
+  for ( int i = 0; i < num; i++ )
+  {
+    int marker;
+    stream >> marker;
+
+    if ( stream.status() != QDataStream::Ok || marker != QtxWorkstack::WidgetMarker )
+      return false;
+
+    QString name;
+    stream >> name;
+
+    int id = -1;
+    stream >> id;
+
+    uchar flags = 0;
+    stream >> flags;
+
+    QtxWorkstackChild* c = myList.at( i );
+    if ( !c->widget() || c->widget()->objectName() != name || c->id() != id )
+      return false;
+
+    if ( id == cur )
+      curChild = c;
+
+    bool vis = flags & QtxWorkstack::Visible;
+    if ( apply && c->visibility() != vis )
+      c->widget()->setVisible( vis );
+  }
+
+  if ( apply && curChild && curChild->widget() && activeWidget() != curChild->widget() )
+    setActiveWidget( curChild->widget() );
+
+  return true;
+}
+
 /*!
   \brief Show/Hide tab bar.
 */
@@ -3095,6 +3403,88 @@ void QtxWorkstack::saveState( QDataStream& stream ) const
 }
 
 bool QtxWorkstack::restoreState( QDataStream& stream )
+{
+  bool upd = updatesEnabled();
+  setUpdatesEnabled( false );
+
+  bool ok = reconcileState( stream ) || rebuildState( stream );
+
+  setUpdatesEnabled( upd );
+
+  return ok;
+}
+
+/*!
+  \brief Restore workstack configuration reusing existing splitters and areas.
+
+  Splitters and areas which are the same as the stored ones are kept and their
+  widgets are not re-parented: only sizes of splitters, visibility and current
+  widgets are changed where they differ. Only the branches of the layout which
+  differ from the stored ones are re-created.
+
+  The stream is checked before anything is changed: if configuration can't
+  be restored (e.g. stored widget is not found), the stream is left unchanged.
+
+  \param stream data stream
+  \return \c true if configuration has been restored
+*/
+bool QtxWorkstack::reconcileState( QDataStream& stream )
+{
+  QIODevice* dev = stream.device();
+  if ( !dev || dev->isSequential() )
+    return false;
+
+  qint64 pos = dev->pos();
+
+  QMap<QString, QtxWorkstackChild*> map;
+  QStringList names;
+  QWidgetList removed;
+
+  // check first: widgets of re-created areas should be found in the replaced ones
+  int marker;
+  stream >> marker;
+  bool ok = stream.status() == QDataStream::Ok && marker == QtxWorkstack::SplitMarker &&
+    mySplit->reconcileState( stream, map, names, removed, false );
+  for ( QStringList::const_iterator it = names.begin(); it != names.end() && ok; ++it )
+    ok = map.contains( *it );
+
+  dev->seek( pos );
+  stream.resetStatus();
+  if ( !ok )
+    return false;
+
+  stream >> marker;
+  mySplit->reconcileState( stream, map, names, removed, true );
+
+  // widgets which are not in the stored configuration are hidden in the first area
+  QList<QtxWorkstackArea*> aList;
+  areas( mySplit, aList, true );
+
+  QtxWorkstackArea* a = !aList.isEmpty() ? aList.first() : 0;
+
+  for ( QMap<QString, QtxWorkstackChild*>::const_iterator it = map.begin(); it != map.end(); ++it )
+  {
+    QtxWorkstackChild* c = it.value();
+    if ( c->widget() )
+      c->widget()->setVisible( false );
+    if ( a )
+      a->insertChild( c );
+    else
+      c->setVisible( false );
+  }
+
+  for ( QWidgetList::const_iterator it = removed.begin(); it != removed.end(); ++it )
+    (*it)->deleteLater();
+
+  return true;
+}
+
+/*!
+  \brief Restore workstack configuration by re-creating splitters and areas.
+  \param stream data stream
+  \return \c true if configuration has been restored
+*/
+bool QtxWorkstack::rebuildState( QDataStream& stream )
 {
   QMap<QString, QtxWorkstackChild*> map;
   QList<QtxWorkstackArea*> areaList;
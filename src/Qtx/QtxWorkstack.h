@@ -35,6 +35,7 @@
 #include <QTabBar>
 #include <QPointer>
 #include <QSplitter>
+#include <QStringList>
 #include <QByteArray>
 
 class QAction;
@@ -147,6 +148,10 @@ protected:
   void                saveState( QDataStream& ) const;
   bool                restoreState( QDataStream& );
 
+private:
+  bool                reconcileState( QDataStream& );
+  bool                rebuildState( QDataStream& );
+
 private:
   QSplitter*          splitter( QtxWorkstackArea* ) const;
   void                splitters( QSplitter*, QList<QSplitter*>&, const bool = false ) const;
@@ -203,6 +208,8 @@ public:
 
   void                saveState( QDataStream& ) const;
   bool                restoreState( QDataStream&, QMap<QString, QtxWorkstackChild*>& );
+  bool                reconcileState( QDataStream&, QMap<QString, QtxWorkstackChild*>&,
+                                      QStringList&, QWidgetList&, const bool );
 };
 
 class QTX_EXPORT QtxWorkstackArea : public QFrame
@@ -247,6 +254,7 @@ public:
 
   void                saveState( QDataStream& ) const;
   bool                restoreState( QDataStream&, QMap<QString, QtxWorkstackChild*>& );
+  bool                reconcileState( QDataStream&, const bool );
 
   void                showTabBar( bool = true);
 
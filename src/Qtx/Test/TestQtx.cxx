@@ -0,0 +1,148 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "QtxWorkstack.h"
+
+#include <QEvent>
+#include <QWidget>
+
+namespace
+{
+  const int NB_AREAS         = 8;
+  const int WINDOWS_PER_AREA = 4;
+  const int NB_WINDOWS       = NB_AREAS * WINDOWS_PER_AREA;
+
+  /*!
+    Event filter counting re-parent and resize events of the watched widgets
+  */
+  class EventCounter : public QObject
+  {
+  public:
+    EventCounter() : myNbParentChange( 0 ), myNbResize( 0 ) {}
+
+    //! Watch the windows and their containers, reset counters
+    void watch( const QWidgetList& theWindows )
+    {
+      for ( QWidgetList::const_iterator it = theWindows.begin(); it != theWindows.end(); ++it ) {
+        (*it)->installEventFilter( this );
+        if ( (*it)->parentWidget() )
+          (*it)->parentWidget()->installEventFilter( this );
+      }
+      myNbParentChange = myNbResize = 0;
+    }
+
+    virtual bool eventFilter( QObject* theObject, QEvent* theEvent )
+    {
+      if ( theEvent->type() == QEvent::ParentChange )
+        myNbParentChange++;
+      else if ( theEvent->type() == QEvent::Resize && theObject->isWidgetType() &&
+                !theObject->inherits( "QtxWorkstackChild" ) )
+        myNbResize++;
+      return QObject::eventFilter( theObject, theEvent );
+    }
+
+    int myNbParentChange;
+    int myNbResize;
+  };
+}
+
+/*!
+  \class QtxTest: test suit
+*/
+class QtxTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( QtxTest );
+  CPPUNIT_TEST( testWorkstackRestore );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void testWorkstackRestore();
+};
+
+/*!
+  Restore the state of a workstack with windows in nested split areas and
+  count re-parent and resize events of the windows and their containers.
+
+  Restoring of the unchanged layout is done in place. After a change of one
+  area only this area is re-created: other windows are not re-parented.
+*/
+void QtxTest::testWorkstackRestore()
+{
+  QtxWorkstack* aWorkstack = new QtxWorkstack();
+  aWorkstack->resize( 1200, 900 );
+  aWorkstack->show();
+
+  QWidgetList aWindows;
+  for ( int i = 0; i < NB_WINDOWS; i++ ) {
+    QWidget* aWindow = new QWidget();
+    aWindow->setObjectName( QString( "window_%1" ).arg( i ) );
+    aWorkstack->addWindow( aWindow );
+    aWindow->show();
+    aWindows.append( aWindow );
+  }
+  // windows of each next area are split from the previous one, alternating the orientation
+  for ( int i = 1; i < NB_AREAS; i++ )
+    aWorkstack->Split( aWindows[i * WINDOWS_PER_AREA], i % 2 ? Qt::Horizontal : Qt::Vertical, QtxWorkstack::SplitAt );
+  QApplication::processEvents();
+
+  QByteArray aState = aWorkstack->saveState( 0 );
+  GuiTest_Timer aTimer( QString( "QtxWorkstack with %1 windows in %2 areas" ).arg( NB_WINDOWS ).arg( NB_AREAS ) );
+  EventCounter aCounter;
+
+  // restoring of the same layout
+  aCounter.watch( aWindows );
+  aTimer.restart();
+  CPPUNIT_ASSERT( aWorkstack->restoreState( aState, 0 ) );
+  QApplication::processEvents();
+  aTimer.step( "unchanged" );
+  aTimer.note( QString( "%1 re-parent, %2 resize events" ).arg( aCounter.myNbParentChange ).arg( aCounter.myNbResize ) );
+  CPPUNIT_ASSERT_EQUAL( 0, aCounter.myNbParentChange );
+  CPPUNIT_ASSERT_EQUAL( 0, aCounter.myNbResize );
+  CPPUNIT_ASSERT( aWorkstack->saveState( 0 ) == aState );
+
+  // restoring after one window of the last area has been moved to a new area
+  aWorkstack->Split( aWindows[NB_WINDOWS - 2], Qt::Vertical, QtxWorkstack::SplitMove );
+  QApplication::processEvents();
+  CPPUNIT_ASSERT( aWorkstack->saveState( 0 ) != aState );
+
+  aCounter.watch( aWindows );
+  aTimer.restart();
+  CPPUNIT_ASSERT( aWorkstack->restoreState( aState, 0 ) );
+  QApplication::processEvents();
+  aTimer.step( "one area changed" );
+  aTimer.note( QString( "%1 re-parent, %2 resize events" ).arg( aCounter.myNbParentChange ).arg( aCounter.myNbResize ) );
+  aTimer.print();
+
+  // only windows of the changed area are moved to the re-created one
+  CPPUNIT_ASSERT( aCounter.myNbParentChange <= WINDOWS_PER_AREA );
+  CPPUNIT_ASSERT( aCounter.myNbResize <= 2 * WINDOWS_PER_AREA );
+  CPPUNIT_ASSERT( aWorkstack->saveState( 0 ) == aState );
+
+  delete aWorkstack;
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( QtxTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"
@@ -622,9 +622,15 @@ PyModuleHelper::PyModuleHelper( LightApp_Module* module ) :
   myPyModule( 0 ), 
   myInterp( 0 ),
   myXmlHandler ( 0 ),
-  myLastActivateStatus( true )
+  myLastActivateStatus( true ),
+  myAsyncSelection( false ),
+  mySelectionDeltas( false ),
+  mySelectionPending( false ),
+  mySelectionBusy( false )
 {
   setObjectName( "python_module_helper" );
+  mySelectionStats.requested = mySelectionStats.delivered = 0;
+  mySelectionStats.totalTime = mySelectionStats.maxTime = mySelectionStats.maxLatency = 0;
 }
 
 /*!
@@ -632,6 +638,12 @@ PyModuleHelper::PyModuleHelper( LightApp_Module* module ) :
 */
 PyModuleHelper::~PyModuleHelper()
 {
+  if ( mySelectionStats.requested > 0 )
+    MESSAGE( "Selection updates: requested " << mySelectionStats.requested
+             << ", delivered " << mySelectionStats.delivered
+             << ", callbacks total " << mySelectionStats.totalTime << " ms"
+             << ", max " << mySelectionStats.maxTime << " ms"
+             << ", max latency " << mySelectionStats.maxLatency << " ms" );
   delete myXmlHandler;
   if ( myInterp && myPyModule ) {
     PyLockWrapper aLock; // Acquire GIL
@@ -750,6 +762,71 @@ QStringList PyModuleHelper::viewManagers() const
   return myViewMgrList;
 }
 
+/*!
+  \brief Check if selection updates are delivered to Python module asynchronously.
+  \return \c true if asynchronous mode is on
+  \sa setAsyncSelection()
+*/
+bool PyModuleHelper::isAsyncSelection() const
+{
+  return myAsyncSelection;
+}
+
+/*!
+  \brief Switch on/off asynchronous delivery of selection updates.
+
+  In asynchronous mode selectionUpdated() returns immediately, and the Python
+  module's onSelectionUpdated() is called later from the event loop. If several
+  updates come before the module has processed the previous one, only the
+  latest selection is delivered.
+
+  Default value is taken from \c async_selection resource of the module's section.
+
+  \param on asynchronous mode flag
+*/
+void PyModuleHelper::setAsyncSelection( bool on )
+{
+  myAsyncSelection = on;
+  if ( !on && mySelectionPending )
+    flushSelection();
+}
+
+/*!
+  \brief Check if selection updates are delivered as added/removed entries.
+  \return \c true if delta mode is on
+  \sa setSelectionDeltas()
+*/
+bool PyModuleHelper::isSelectionDeltas() const
+{
+  return mySelectionDeltas;
+}
+
+/*!
+  \brief Switch on/off delivery of selection updates as deltas.
+
+  If this mode is on and the Python module defines onSelectionDelta( added, removed )
+  method, it is called instead of onSelectionUpdated() with the entries added to and
+  removed from the selection since the previous delivery.
+
+  Default value is taken from \c selection_deltas resource of the module's section.
+
+  \param on delta mode flag
+*/
+void PyModuleHelper::setSelectionDeltas( bool on )
+{
+  mySelectionDeltas = on;
+  myLastSelection.clear();
+}
+
+/*!
+  \brief Get statistics of selection updates delivered to the Python module.
+  \return selection updates statistics
+*/
+PyModuleHelper::SelectionStats PyModuleHelper::selectionStats() const
+{
+  return mySelectionStats;
+}
+
 /*!
   \brief Initialization of the Python-based SALOME module.
   
@@ -787,6 +864,11 @@ void PyModuleHelper::initialize( CAM_Application* app )
 
   // try to get XML resource file name
   SUIT_ResourceMgr* resMgr = myModule->getApp()->resourceMgr();
+  if ( resMgr ) {
+    // get selection updates delivery mode
+    setAsyncSelection( resMgr->booleanValue( myModule->name(), "async_selection", myAsyncSelection ) );
+    setSelectionDeltas( resMgr->booleanValue( myModule->name(), "selection_deltas", mySelectionDeltas ) );
+  }
   if ( !myXmlHandler && resMgr ) {
     // get current language
     QString lang = resMgr->stringValue( "language", "language", "en" );
@@ -1172,6 +1254,57 @@ void PyModuleHelper::selectionUpdated(const QStringList& entries)
   FuncMsg fmsg( "PyModuleHelper::selectionUpdated()" );
   MESSAGE("selectionUpdated");
 
+  if ( !mySelectionPending )
+    mySelectionWait.start();
+  mySelectionStats.requested++;
+
+  if ( !myAsyncSelection ) {
+    deliverSelection( entries );
+    return;
+  }
+
+  // keep only the latest selection; it is delivered when the event loop
+  // is reached or, if the module is processing previous one, after that
+  myPendingSelection = entries;
+  if ( !mySelectionPending && !mySelectionBusy )
+    QMetaObject::invokeMethod( this, "flushSelection", Qt::QueuedConnection );
+  mySelectionPending = true;
+}
+
+/*!
+  \brief Deliver the latest pending selection update to the Python module.
+  \internal
+*/
+void PyModuleHelper::flushSelection()
+{
+  if ( !mySelectionPending || mySelectionBusy )
+    return;
+
+  QStringList entries = myPendingSelection;
+  myPendingSelection.clear();
+  mySelectionPending = false;
+
+  deliverSelection( entries );
+
+  // selection has been changed while Python module was processing previous one
+  if ( mySelectionPending )
+    QMetaObject::invokeMethod( this, "flushSelection", Qt::QueuedConnection );
+}
+
+/*!
+  \brief Pass selection to the Python module.
+  \internal
+  \param entries selected entries
+*/
+void PyModuleHelper::deliverSelection(const QStringList& entries)
+{
+  FuncMsg fmsg( "PyModuleHelper::deliverSelection()" );
+
+  bool wasBusy = mySelectionBusy;
+  mySelectionBusy = true;
+  QElapsedTimer aCallTimer;
+  aCallTimer.start();
+
   // perform synchronous request to Python event dispatcher
   class SelectionReq : public PyInterp_LockRequest
   {
@@ -1198,6 +1331,17 @@ void PyModuleHelper::selectionUpdated(const QStringList& entries)
 
   // post request
   PyInterp_Dispatcher::Get()->Exec( new SelectionReq( myInterp, this, entries ) );
+
+  qint64 aCallTime = aCallTimer.elapsed();
+  mySelectionStats.delivered++;
+  mySelectionStats.totalTime += aCallTime;
+  mySelectionStats.maxTime = qMax( mySelectionStats.maxTime, aCallTime );
+  mySelectionStats.maxLatency = qMax( mySelectionStats.maxLatency, mySelectionWait.elapsed() );
+  mySelectionBusy = wasBusy;
+
+  // next update starts waiting now
+  if ( mySelectionPending )
+    mySelectionWait.start();
 }
 
 /*!
@@ -2258,13 +2402,39 @@ void PyModuleHelper::internalSelectionUpdated(const QStringList& entries)
   if (!myInterp || !myPyModule)
     return; // Error
 
-  QStringList* theList = new QStringList(entries);
-
 #if SIP_VERSION >= 0x041300
   static const sipTypeDef *sipType_QStringList = 0;
   if (!sipType_QStringList)
     sipType_QStringList = sipFindType("QStringList");
 #endif
+
+  if (mySelectionDeltas && PyObject_HasAttrString(myPyModule, (char*) "onSelectionDelta"))
+    {
+      // pass only entries added to and removed from previously delivered selection
+      QSet<QString> current = entries.toSet();
+      QStringList* added = new QStringList();
+      QStringList* removed = new QStringList();
+      foreach (const QString& entry, entries)
+        if (!myLastSelection.contains(entry))
+          added->append(entry);
+      foreach (const QString& entry, myLastSelection)
+        if (!current.contains(entry))
+          removed->append(entry);
+      myLastSelection = current;
+
+      PyObjWrapper sipAdded( sipBuildResult( 0, "D", added, sipType_QStringList, NULL ) );
+      PyObjWrapper sipRemoved( sipBuildResult( 0, "D", removed, sipType_QStringList, NULL ) );
+      MESSAGE("call onSelectionDelta");
+      PyObjWrapper res(PyObject_CallMethod(myPyModule, (char*) "onSelectionDelta", (char*) "OO",
+                                           sipAdded.get(), sipRemoved.get()));
+      if (!res)
+        {
+          PyErr_Print();
+        }
+      return;
+    }
+
+  QStringList* theList = new QStringList(entries);
   PyObjWrapper sipList( sipBuildResult( 0, "D", theList, sipType_QStringList, NULL ) );
   if (PyObject_HasAttrString(myPyModule, (char*) "onSelectionUpdated"))
     {
@@ -28,10 +28,12 @@
 
 #include "PyInterp_Interp.h" // !!! WARNING !!! THIS INCLUDE MUST BE THE VERY FIRST !!!
 
+#include <QElapsedTimer>
 #include <QIcon>
 #include <QList>
 #include <QMap>
 #include <QObject>
+#include <QSet>
 #include <QStringList>
 
 class CAM_Application;
@@ -50,6 +52,17 @@ class SALOME_PYQT_LIGHT_EXPORT PyModuleHelper : public QObject
 {
   Q_OBJECT
 
+public:
+  //! Statistics of selection updates delivered to Python module
+  struct SelectionStats
+  {
+    int    requested;  //!< number of selection updates received
+    int    delivered;  //!< number of selection updates passed to Python module
+    qint64 totalTime;  //!< total time spent in Python callbacks (ms)
+    qint64 maxTime;    //!< longest Python callback (ms)
+    qint64 maxLatency; //!< longest delay from an update to the end of its delivery (ms)
+  };
+
 private:
   class XmlHandler;
   class InitLocker;
@@ -63,6 +76,14 @@ private:
   QMap<int, int>             myWindowsMap;         //!< windows map
   QStringList                myViewMgrList;        //!< compatible view managers list
   bool                       myLastActivateStatus; //!< latest module activation status
+  bool                       myAsyncSelection;     //!< selection updates are delivered asynchronously
+  bool                       mySelectionDeltas;    //!< selection updates are delivered as added/removed entries
+  bool                       mySelectionPending;   //!< asynchronous selection update is waiting for delivery
+  bool                       mySelectionBusy;      //!< selection update is being delivered
+  QStringList                myPendingSelection;   //!< latest selection waiting for delivery
+  QSet<QString>              myLastSelection;      //!< latest selection delivered as delta
+  QElapsedTimer              mySelectionWait;      //!< started by the oldest undelivered selection update
+  SelectionStats             mySelectionStats;     //!< selection updates statistics
 
 public:
   PyModuleHelper( LightApp_Module* );
@@ -79,6 +100,12 @@ public:
   QMap<int, int>             windows() const;
   QStringList                viewManagers() const;
 
+  bool                       isAsyncSelection() const;
+  void                       setAsyncSelection( bool );
+  bool                       isSelectionDeltas() const;
+  void                       setSelectionDeltas( bool );
+  SelectionStats             selectionStats() const;
+
 public slots:
   void                       initialize( CAM_Application* );
   bool                       activate( SUIT_Study* study );
@@ -106,6 +133,9 @@ public slots:
 
   void                       onObjectBrowserClicked(SUIT_DataObject*, int);
 
+private slots:
+  void                       flushSelection();
+
 private:
   void                       initInterp();
   void                       importModule();
@@ -119,6 +149,7 @@ private:
   void                       internalPreferencesChanged( const QString&, const QString& );
   void                       internalStudyChanged( SUIT_Study* );
   void                       internalActionActivated( int );
+  void                       deliverSelection(const QStringList&);
   void                       internalSelectionUpdated(const QStringList&);
   void                       internalContextMenu( const QString&, QMenu* );
   void                       internalCreatePreferences();
@@ -65,6 +65,8 @@
 
 #include <utilities.h>
 
+#include <QMap>
+
 /*!
   \class SALOMEGUI_Swig
   \brief Python interface module for SALOME GUI.
@@ -78,6 +80,7 @@
   - getSelected() : get entry of the speicified selected item
   - ClearIObjects() : clear selection
   - Display(), DisplayOnly(), Erase() : display/erase objects
+  - DisplayMany(), EraseMany(), SelectMany() : process list of objects at once
   - etc.
 
   Instance of this class is created every time "import salome" line is typed 
@@ -136,6 +139,21 @@ static LightApp_Study* getActiveStudy()
   return 0;
 }
 
+/*!
+  \brief Convert list of entries passed from Python to string list
+  \internal
+  \param theEntries objects entries
+  \return string list
+*/
+static QStringList toStringList( const std::list<std::string>& theEntries )
+{
+  QStringList entries;
+  std::list<std::string>::const_iterator it;
+  for ( it = theEntries.begin(); it != theEntries.end(); ++it )
+    entries.append( QString::fromStdString( *it ) );
+  return entries;
+}
+
 /*!
   \brief Constructor.
 */
@@ -400,6 +418,38 @@ void SALOMEGUI_Swig::ClearIObjects()
   ProcessVoidEvent( new TEvent() );
 }
 
+/*!
+  \brief Add several objects to the current selection.
+
+  All objects are selected at once, so the selection is changed
+  (and selection listeners are notified) only one time.
+
+  \param theEntries objects entries
+*/
+void SALOMEGUI_Swig::SelectMany( const std::list<std::string>& theEntries )
+{
+  class TEvent: public SALOME_Event
+  {
+  public:
+    QStringList myEntries;
+    TEvent( const std::list<std::string>& theEntries ) : myEntries( toStringList( theEntries ) ) {}
+    virtual void Execute()
+    {
+      if ( LightApp_Application* anApp = getApplication() ) {
+        LightApp_Study*       aStudy  = dynamic_cast<LightApp_Study*>( anApp->activeStudy() ); // for sure!
+        LightApp_SelectionMgr* aSelMgr = anApp->selectionMgr(); 
+        if ( aStudy && aSelMgr && !myEntries.isEmpty() ) {
+          SALOME_ListIO anIOList;
+          foreach( QString entry, myEntries )
+            anIOList.Append( new SALOME_InteractiveObject( entry.toUtf8(), "", "" ) );
+          aSelMgr->setSelectedObjects( anIOList, true );
+        }
+      }
+    }
+  };
+  ProcessVoidEvent( new TEvent( theEntries ) );
+}
+
 /*!
   \brief Display an object in the current view window.
 
@@ -579,6 +629,103 @@ void SALOMEGUI_Swig::EraseAll()
   ProcessVoidEvent( new TEvent() );
 }
 
+/*!
+  \brief Display or erase several objects in the current view window.
+  \internal
+
+  Objects are passed to the displayers of their components by one list
+  per component, and the view window is repainted once at the end.
+
+  \param theEntries objects entries
+  \param theDisplay \c true to display objects, \c false to erase them
+*/
+static void setVisibility( const QStringList& theEntries, const bool theDisplay )
+{
+  LightApp_Application* anApp  = getApplication();
+  LightApp_Study*       aStudy = getActiveStudy();
+  if ( !anApp || !aStudy )
+    return;
+
+  QMap<QString, QStringList> entriesByComponent;
+  foreach( QString entry, theEntries ) {
+    QStringList entries;
+    if( aStudy->isComponent( entry ) )
+      aStudy->children( entry, entries );
+    else
+      entries.append( entry );
+    QStringList& compEntries = entriesByComponent[ aStudy->componentDataType( entry ) ];
+    foreach( QString anEntry, entries )
+      compEntries.append( aStudy->referencedToEntry( anEntry ) );
+  }
+
+  bool isChanged = false;
+  QMap<QString, QStringList>::const_iterator it;
+  for ( it = entriesByComponent.constBegin(); it != entriesByComponent.constEnd(); ++it ) {
+    LightApp_Displayer* d = LightApp_Displayer::FindDisplayer( it.key(), true );
+    if ( !d ) continue;
+    if ( theDisplay )
+      d->Display( it.value(), false, 0 );
+    else
+      d->Erase( it.value(), false, false, 0 );
+    isChanged = true;
+  }
+
+  if ( isChanged ) {
+    if ( SALOME_View* view = LightApp_Displayer::GetActiveView() )
+      view->Repaint();
+  }
+}
+
+/*!
+  \brief Display several objects in the current view window.
+
+  Unlike calling Display() for each object, all objects are processed
+  in one request to the GUI and the view window is repainted only once.
+
+  \param theEntries objects entries
+*/
+void SALOMEGUI_Swig::DisplayMany( const std::list<std::string>& theEntries )
+{
+  SetVisibilityMany( theEntries, true );
+}
+
+/*!
+  \brief Erase several objects in the current view window.
+
+  Unlike calling Erase() for each object, all objects are processed
+  in one request to the GUI and the view window is repainted only once.
+
+  \param theEntries objects entries
+*/
+void SALOMEGUI_Swig::EraseMany( const std::list<std::string>& theEntries )
+{
+  SetVisibilityMany( theEntries, false );
+}
+
+/*!
+  \brief Display or erase several objects in the current view window.
+  \param theEntries objects entries
+  \param theVisible \c true to display objects, \c false to erase them
+  \sa DisplayMany(), EraseMany()
+*/
+void SALOMEGUI_Swig::SetVisibilityMany( const std::list<std::string>& theEntries, bool theVisible )
+{
+  class TEvent: public SALOME_Event
+  {
+    QStringList myEntries;
+    bool        myVisible;
+  public:
+    TEvent( const std::list<std::string>& theEntries, bool theVisible )
+      : myEntries( toStringList( theEntries ) ), myVisible( theVisible ) {}
+    virtual void Execute()
+    {
+      setVisibility( myEntries, myVisible );
+    }
+  };
+  if ( !theEntries.empty() )
+    ProcessVoidEvent( new TEvent( theEntries, theVisible ) );
+}
+
 /*!
   \fn bool SALOMEGUI_Swig::IsInCurrentView( const char* theEntry )
   \brief Check it the object is displayed in the current view window.
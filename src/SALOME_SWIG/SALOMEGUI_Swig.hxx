@@ -50,12 +50,16 @@ public:
   void             AddIObject( const char*  );
   void             RemoveIObject( const char*  );
   void             ClearIObjects();
+  void             SelectMany( const std::list<std::string>& );
 
   void             Display( const char* );
   void             DisplayOnly( const char* );
   void             Erase( const char* );
   void             DisplayAll();
   void             EraseAll();
+  void             DisplayMany( const std::list<std::string>& );
+  void             EraseMany( const std::list<std::string>& );
+  void             SetVisibilityMany( const std::list<std::string>&, bool );
   bool             IsInCurrentView( const char* );
   void             UpdateView();
 
@@ -78,6 +78,7 @@ public:
   void AddIObject(const char *Entry);
   void RemoveIObject(const char *Entry);
   void ClearIObjects();
+  void SelectMany(const std::list<std::string>& Entries);
 
   /* display/erase */
   void Display(const char *Entry);
@@ -85,6 +86,9 @@ public:
   void Erase(const char *Entry);
   void DisplayAll();
   void EraseAll();
+  void DisplayMany(const std::list<std::string>& Entries);
+  void EraseMany(const std::list<std::string>& Entries);
+  void SetVisibilityMany(const std::list<std::string>& Entries, bool Visible);
   bool IsInCurrentView(const char *Entry);
   void UpdateView();
 
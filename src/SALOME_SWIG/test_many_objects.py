@@ -86,6 +86,33 @@ for i in range(0,myNb1):
 # >>> Updating Object Browser ================================================
 salome.sg.updateObjBrowser()
 
+# >>> Comparing per-object and batched GUI calls =============================
+# each per-object call is a separate request to the GUI thread,
+# a batched call processes all objects in one request
+import time
+
+if salome.sg.hasDesktop():
+    myEntries = []
+    myIter = myStudy.NewChildIterator(myComponent)
+    myIter.InitEx(1)
+    while myIter.More():
+        myEntries.append(myIter.Value().GetID())
+        myIter.Next()
+
+    salome.sg.ClearIObjects()
+    myStart = time.time()
+    for myEntry in myEntries:
+        salome.sg.AddIObject(myEntry)
+    myOneByOne = time.time() - myStart
+
+    salome.sg.ClearIObjects()
+    myStart = time.time()
+    salome.sg.SelectMany(myEntries)
+    myBatched = time.time() - myStart
+
+    print("Selection of %d objects: one by one %.3f s, batched %.3f s" % (len(myEntries), myOneByOne, myBatched))
+    salome.sg.ClearIObjects()
+
 # ============================================================================
 
 
@@ -65,6 +65,73 @@ SOCC_Viewer::~SOCC_Viewer()
 {
 }
 
+/*!
+  Collects displayed AIS objects associated with the interactive object.
+  Lookup is done via the entry2aisobjects map, i.e. without
+  iterating through all objects displayed in the viewer.
+  Objects displayed by modules directly in the context are not in the map:
+  they are looked for in \a theUnmapped map of displayed objects, if it is
+  given, or among all displayed objects otherwise.
+  \param obj - interactive object
+  \param theList - list to be filled with AIS objects
+  \param theUnmapped - displayed objects by entries, see displayedObjects( AISMap& )
+*/
+void SOCC_Viewer::displayedObjects( const Handle(SALOME_InteractiveObject)& obj,
+                                    AIS_ListOfInteractive& theList,
+                                    const AISMap* theUnmapped )
+{
+  if ( obj.IsNull() )
+    return;
+
+  Handle(AIS_InteractiveContext) ic = getAISContext();
+  const std::vector<Handle(AIS_InteractiveObject)>* aMapped = 0;
+  if ( obj->hasEntry() )
+  {
+    AISMap::const_iterator it = entry2aisobjects.find(obj->getEntry());
+    if ( it != entry2aisobjects.end() )
+      aMapped = &it->second;
+    else if ( theUnmapped && ( it = theUnmapped->find(obj->getEntry()) ) != theUnmapped->end() )
+      aMapped = &it->second;
+  }
+
+  AIS_ListOfInteractive aCandidates;
+  if ( aMapped )
+  {
+    for ( unsigned int ind = 0; ind < aMapped->size(); ind++ )
+      if ( !(*aMapped)[ind].IsNull() && ic->IsDisplayed( (*aMapped)[ind] ) )
+        aCandidates.Append( (*aMapped)[ind] );
+  }
+  else if ( !theUnmapped )
+    ic->DisplayedObjects( aCandidates );
+
+  for ( AIS_ListIteratorOfListOfInteractive ite( aCandidates ); ite.More(); ite.Next() )
+  {
+    // AIS object may have been re-assigned to another owner after displaying
+    Handle(SALOME_InteractiveObject) anObj =
+      Handle(SALOME_InteractiveObject)::DownCast( ite.Value()->GetOwner() );
+    if ( !anObj.IsNull() && anObj->hasEntry() && anObj->isSame( obj ) )
+      theList.Append( ite.Value() );
+  }
+}
+
+/*!
+  Collects all displayed AIS objects by entries of their owners,
+  with a single pass through the objects displayed in the viewer.
+  \param theMap - map to be filled with AIS objects
+*/
+void SOCC_Viewer::displayedObjects( AISMap& theMap )
+{
+  AIS_ListOfInteractive aDisplayed;
+  getAISContext()->DisplayedObjects( aDisplayed );
+  for ( AIS_ListIteratorOfListOfInteractive ite( aDisplayed ); ite.More(); ite.Next() )
+  {
+    Handle(SALOME_InteractiveObject) anObj =
+      Handle(SALOME_InteractiveObject)::DownCast( ite.Value()->GetOwner() );
+    if ( !anObj.IsNull() && anObj->hasEntry() )
+      theMap[anObj->getEntry()].push_back( ite.Value() );
+  }
+}
+
 /*!
   Hilights/unhilights object in viewer
   \param obj - object to be updated
@@ -75,25 +142,54 @@ bool SOCC_Viewer::highlight( const Handle(SALOME_InteractiveObject)& obj,
                              bool hilight, bool upd )
 {
   AIS_ListOfInteractive List;
-  getAISContext()->DisplayedObjects(List);
-  
-  AIS_ListIteratorOfListOfInteractive ite(List);
-  for ( ; ite.More(); ite.Next() )
-  {
-    Handle(SALOME_InteractiveObject) anObj =
-      Handle(SALOME_InteractiveObject)::DownCast( ite.Value()->GetOwner() );
+  displayedObjects( obj, List );
 
-    if ( !anObj.IsNull() && anObj->hasEntry() && anObj->isSame( obj ) )
+  // highlight sub-shapes only when local selection is active
+  if ( !List.IsEmpty() )
+    OCCViewer_Viewer::highlight( List.First(), hilight, false );
+
+  if( upd )
+    update();
+    
+  return false;
+}
+
+/*!
+  Hilights/unhilights several objects in viewer at once.
+  Objects which are not in the entry2aisobjects map are looked for with
+  a single pass through all displayed objects.
+  Viewer is updated only once, after all objects are processed.
+  \param objs - objects to be updated
+  \param hilight - if it is true, objects will be hilighted, otherwise they will be unhilighted
+  \param update - update current viewer
+  \param notFound - if given, filled with objects which are not displayed in the viewer
+*/
+bool SOCC_Viewer::highlight( const SALOME_ListIO& objs, bool hilight, bool upd,
+                             SALOME_ListIO* notFound )
+{
+  AISMap anUnmapped;
+  bool isCollected = false;
+  for ( SALOME_ListIteratorOfListIO it( objs ); it.More(); it.Next() )
+  {
+    const Handle(SALOME_InteractiveObject)& anIO = it.Value();
+    if ( !isCollected && !anIO.IsNull() && anIO->hasEntry() &&
+         entry2aisobjects.find( anIO->getEntry() ) == entry2aisobjects.end() )
     {
-      OCCViewer_Viewer::highlight( ite.Value(), hilight, false );
-      // highlight sub-shapes only when local selection is active
-      break;
+      displayedObjects( anUnmapped );
+      isCollected = true;
     }
+
+    AIS_ListOfInteractive List;
+    displayedObjects( anIO, List, &anUnmapped );
+    if ( !List.IsEmpty() )
+      OCCViewer_Viewer::highlight( List.First(), hilight, false );
+    else if ( notFound )
+      notFound->Append( anIO );
   }
-    
+
   if( upd )
     update();
-    
+
   return false;
 }
 
@@ -106,17 +202,8 @@ bool SOCC_Viewer::isInViewer( const Handle(SALOME_InteractiveObject)& obj,
                               bool /*onlyInViewer*/ )
 {
   AIS_ListOfInteractive List;
-  getAISContext()->DisplayedObjects(List);
-  AIS_ListIteratorOfListOfInteractive ite(List);
-  for ( ; ite.More(); ite.Next() )
-  {
-    Handle(SALOME_InteractiveObject) anObj =
-        Handle(SALOME_InteractiveObject)::DownCast( ite.Value()->GetOwner() );
-
-    if ( !anObj.IsNull() && anObj->hasEntry() && anObj->isSame( obj ) )
-      return true;
-  }
-  return false;
+  displayedObjects( obj, List );
+  return !List.IsEmpty();
 }
 
 /*!
@@ -230,7 +317,7 @@ void SOCC_Viewer::rename( const Handle(SALOME_InteractiveObject)& obj,
                           const QString& name )
 {
   AIS_ListOfInteractive List;
-  getAISContext()->DisplayedObjects(List);
+  displayedObjects( obj, List );
   
   AIS_ListIteratorOfListOfInteractive ite(List);
   while (ite.More())
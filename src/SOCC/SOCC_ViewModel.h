@@ -31,6 +31,8 @@
 #include "SALOME_Prs.h"
 #include "OCCViewer_ViewModel.h"
 
+#include <AIS_ListOfInteractive.hxx>
+
 class SALOME_ListIO;
 class SALOME_InteractiveObject;
 
@@ -44,6 +46,7 @@ public:
 
   /* Selection management */
   bool      highlight( const Handle(SALOME_InteractiveObject)&, bool, bool=true );
+  bool      highlight( const SALOME_ListIO&, bool, bool=true, SALOME_ListIO* = 0 );
   bool      isInViewer( const Handle(SALOME_InteractiveObject)&, bool=false );
 
   void      setColor( const Handle(SALOME_InteractiveObject)&, const QColor&, bool=true );
@@ -70,6 +73,13 @@ public:
 
   //a map to store AIS objects associated to a SALOME entry
   std::map< std::string , std::vector<Handle(AIS_InteractiveObject)> > entry2aisobjects;
+
+private:
+  typedef std::map< std::string , std::vector<Handle(AIS_InteractiveObject)> > AISMap;
+
+  void                        displayedObjects( const Handle(SALOME_InteractiveObject)&,
+                                                AIS_ListOfInteractive&, const AISMap* = 0 );
+  void                        displayedObjects( AISMap& );
 };
 
 #ifdef WIN32
@@ -52,7 +52,9 @@ SUIT_DataObject::SUIT_DataObject( SUIT_DataObject* p )
   myOpen( false ),
   myCheck( false ),
   myAutoDel( true ),
-  _modified( false )
+  _modified( false ),
+  myPos( -1 ),
+  myValidPos( 0 )
 {
   setParent( p );
   signal()->emitCreated( this );
@@ -75,7 +77,10 @@ SUIT_DataObject::~SUIT_DataObject()
   signal()->emitDestroyed( this );
 
   for ( DataObjectList::iterator it = myChildren.begin(); it != myChildren.end(); ++it )
+  {
     (*it)->myParent = 0;
+    (*it)->myPos = -1;
+  }
 
   if ( autoDeleteChildren() )
   {
@@ -130,12 +135,41 @@ int SUIT_DataObject::childCount() const
 
 /*!
   \brief Get the index of the specified object in the child list.
+
+  Each child caches its position; the cache is updated lazily after insertion or
+  removal of a child in the middle of the list, so that sibling navigation is
+  a constant time operation in average.
+
   \param obj child object
   \return subobject position or -1 if it does not belong to this object
 */
 int SUIT_DataObject::childPos( const SUIT_DataObject* obj ) const
 {
-  return myChildren.indexOf( (SUIT_DataObject*)obj );
+  if ( !obj || obj->myPos < 0 )
+    return -1;
+
+  if ( obj->myPos < myChildren.count() && myChildren.at( obj->myPos ) == obj )
+    return obj->myPos;
+
+  if ( myValidPos < myChildren.count() )
+  {
+    updateChildPositions();
+    if ( obj->myPos >= 0 && obj->myPos < myChildren.count() && myChildren.at( obj->myPos ) == obj )
+      return obj->myPos;
+  }
+
+  return -1;
+}
+
+/*!
+  \brief Update cached positions of the children, which have been shifted
+  by insertion, removal or move of the child object.
+*/
+void SUIT_DataObject::updateChildPositions() const
+{
+  for ( int i = myValidPos; i < myChildren.count(); i++ )
+    myChildren.at( i )->myPos = i;
+  myValidPos = myChildren.count();
 }
 
 /*!
@@ -152,8 +186,11 @@ void SUIT_DataObject::moveChildPos( SUIT_DataObject* theObj, int theNewPos)
   if (aNewPos < 0) aNewPos = 0;
   if (aNewPos > (myChildren.size() - 1)) aNewPos = myChildren.size() - 1;
 
-  if (myChildren.removeOne(theObj))
-    myChildren.insert(aNewPos, theObj);
+  int aCurPos = childPos(theObj);
+  if (aCurPos < 0 || aCurPos == aNewPos) return;
+
+  myChildren.move(aCurPos, aNewPos);
+  myValidPos = qMin(myValidPos, qMin(aCurPos, aNewPos));
 }
 
 
@@ -305,26 +342,39 @@ void SUIT_DataObject::appendChild( SUIT_DataObject* obj )
 */
 void SUIT_DataObject::insertChild( SUIT_DataObject* obj, int position )
 {
-  if ( !obj || myChildren.contains( obj ) )
+  if ( !obj || childPos( obj ) >= 0 )
     return;
 
-  int pos = position < 0 ? myChildren.count() : position;
-  myChildren.insert( qMin( pos, (int)myChildren.count() ), obj );
+  // detach object from the previous parent first: it caches only one position
+  if ( obj->parent() && obj->parent() != this )
+    obj->setParent( 0 );
+
+  int pos = qMin( position < 0 ? myChildren.count() : position, (int)myChildren.count() );
+  myChildren.insert( pos, obj );
+  obj->myPos = pos;
+  myValidPos = myValidPos >= pos ? pos + 1 : myValidPos;
   obj->setParent( this );
   signal()->emitInserted( obj, this );
 }
 
 /*!
   \brief Insert new child object into the list of the children (faster version of insertChild without signal).
+
+  The tree model is not notified; only attached() signal is emitted, for the
+  observers which index the data tree.
+
   \param obj child object being added
   \param position child position
 */
 void SUIT_DataObject::insertChildAtPos( SUIT_DataObject* obj, int position )
 {
   if ( !obj )return;
-  int pos = position < 0 ? myChildren.count() : position;
-  myChildren.insert( qMin( pos, (int)myChildren.count() ), obj );
+  int pos = qMin( position < 0 ? myChildren.count() : position, (int)myChildren.count() );
+  myChildren.insert( pos, obj );
+  obj->myPos = pos;
+  myValidPos = myValidPos >= pos ? pos + 1 : myValidPos;
   obj->assignParent( this );
+  signal()->emitAttached( obj, this );
 }
 
 /*!
@@ -337,7 +387,11 @@ void SUIT_DataObject::removeChild( SUIT_DataObject* obj, const bool del )
   if ( !obj )
     return;
 
-  if ( myChildren.removeAll( obj ) ) {
+  int pos = childPos( obj );
+  if ( pos >= 0 ) {
+    myChildren.removeAt( pos );
+    obj->myPos = -1;
+    myValidPos = qMin( myValidPos, pos );
     signal()->emitRemoved( obj, this );
     obj->setParent( 0 );
 
@@ -962,6 +1016,17 @@ void SUIT_DataObject::Signal::emitInserted( SUIT_DataObject* object, SUIT_DataOb
   emit( inserted( object, parent ) );
 }
 
+/*!
+  \brief Emit signal about data object attached to the parent data object
+  without notification of the tree model (see insertChildAtPos()).
+  \param object data object being attached
+  \param parent parent data object
+*/
+void SUIT_DataObject::Signal::emitAttached( SUIT_DataObject* object, SUIT_DataObject* parent )
+{
+  emit( attached( object, parent ) );
+}
+
 /*!
   \brief Emit signal about data object removed from the parent data object.
   \param object data object being removed
@@ -148,6 +148,9 @@ public:
 
   void                        dump( const int indent = 2 ) const; // dump to cout
 
+private:
+  void                        updateChildPositions() const;
+
 private:
   SUIT_DataObject*            myParent;
   bool                        myOpen;
@@ -155,6 +158,8 @@ private:
   bool                        myAutoDel;
   DataObjectList              myChildren;
   bool                        _modified;
+  mutable int                 myPos;      //!< cached position in the parent's children list, -1 if none
+  mutable int                 myValidPos; //!< cached positions of children [0, myValidPos) are up to date
 
   static Signal*              mySignal;
 
@@ -174,6 +179,7 @@ private:
   void emitCreated( SUIT_DataObject* );
   void emitDestroyed( SUIT_DataObject* );
   void emitInserted( SUIT_DataObject*, SUIT_DataObject* );
+  void emitAttached( SUIT_DataObject*, SUIT_DataObject* );
   void emitRemoved( SUIT_DataObject*, SUIT_DataObject* );
   void emitModified( SUIT_DataObject* );
 
@@ -183,6 +189,7 @@ signals:
   void created( SUIT_DataObject* );
   void destroyed( SUIT_DataObject* );
   void inserted( SUIT_DataObject*, SUIT_DataObject* );
+  void attached( SUIT_DataObject*, SUIT_DataObject* );
   void removed( SUIT_DataObject*, SUIT_DataObject* );
   void modified( SUIT_DataObject* );
 
@@ -520,7 +520,7 @@ SUIT_FoundActionTreeModule::SUIT_FoundActionTreeModule(const QString& theModuleI
 void SUIT_FoundActionTreeModule::setAssets(const SUIT_ShortcutModuleAssets& theAssets, const QString& theLang)
 {
   setText(SUIT_FoundActionTree::ColumnIdx::Name, theAssets.bestName(theLang));
-  setIcon(SUIT_FoundActionTree::ColumnIdx::Name, theAssets.myIcon);
+  setIcon(SUIT_FoundActionTree::ColumnIdx::Name, theAssets.ownIcon());
 }
 
 QVariant SUIT_FoundActionTreeModule::getValue(SUIT_FoundActionTree::SortKey theKey) const
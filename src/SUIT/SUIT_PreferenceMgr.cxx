@@ -23,9 +23,125 @@
 #include "SUIT_PreferenceMgr.h"
 #include "SUIT_PagePrefShortcutTreeItem.h"
 
+#include <QtxResourceMgr.h>
+
+#include <QPair>
+
+/*!
+  \class SUIT_PreferenceMgr::Descriptor
+  \brief Placeholder of the preference item which widgets are not created yet.
+
+  Keeps type, resource and options of the item; the real item is created
+  when the page containing it is shown for the first time.
+*/
+class SUIT_PreferenceMgr::Descriptor : public QtxPreferenceItem
+{
+public:
+  typedef QList< QPair<QString, QVariant> > OptionList;
+
+public:
+  Descriptor( const QString&, QtxPreferenceItem*, const PrefItemType,
+              const QString&, const QString& );
+
+  PrefItemType      type() const;
+  const OptionList& options() const;
+  bool              isDefault() const;
+
+  virtual void      store();
+  virtual void      retrieve();
+  virtual void      retrieveDefault();
+
+protected:
+  virtual QVariant  optionValue( const QString& ) const;
+  virtual void      setOptionValue( const QString&, const QVariant& );
+
+private:
+  PrefItemType      myType;
+  OptionList        myOptions;
+  bool              myDefault;
+  QString           myValue;
+};
+
+SUIT_PreferenceMgr::Descriptor::Descriptor( const QString& title, QtxPreferenceItem* parent,
+                                            const PrefItemType type,
+                                            const QString& sect, const QString& param )
+: QtxPreferenceItem( title, sect, param, parent ),
+myType( type ),
+myDefault( false )
+{
+}
+
+SUIT_PreferenceMgr::PrefItemType SUIT_PreferenceMgr::Descriptor::type() const
+{
+  return myType;
+}
+
+/*!
+  \brief Get options in order of their setting, to be replayed on the real item.
+*/
+const SUIT_PreferenceMgr::Descriptor::OptionList& SUIT_PreferenceMgr::Descriptor::options() const
+{
+  return myOptions;
+}
+
+/*!
+  \brief Check if default value has been retrieved and not stored yet.
+*/
+bool SUIT_PreferenceMgr::Descriptor::isDefault() const
+{
+  return myDefault;
+}
+
+/*!
+  \brief Store default value if it has been retrieved, otherwise the resource is not changed.
+*/
+void SUIT_PreferenceMgr::Descriptor::store()
+{
+  if ( myDefault )
+    setResourceValue( myValue );
+  myDefault = false;
+}
+
+/*!
+  \brief Nothing to retrieve, the resource is read when the real item is created.
+*/
+void SUIT_PreferenceMgr::Descriptor::retrieve()
+{
+  myDefault = false;
+}
+
+/*!
+  \brief Remember default value to be stored or shown by the real item.
+*/
+void SUIT_PreferenceMgr::Descriptor::retrieveDefault()
+{
+  QString sect, param;
+  resource( sect, param );
+  myDefault = resourceMgr() && resourceMgr()->hasValue( sect, param );
+  if ( myDefault )
+    myValue = resourceValue();
+}
+
+QVariant SUIT_PreferenceMgr::Descriptor::optionValue( const QString& name ) const
+{
+  for ( int i = myOptions.count() - 1; i >= 0; i-- )
+  {
+    if ( myOptions.at( i ).first == name )
+      return myOptions.at( i ).second;
+  }
+  return QtxPreferenceItem::optionValue( name );
+}
+
+void SUIT_PreferenceMgr::Descriptor::setOptionValue( const QString& name, const QVariant& val )
+{
+  myOptions.append( qMakePair( name, val ) );
+  QtxPreferenceItem::setOptionValue( name, val );
+}
+
 SUIT_PreferenceMgr::SUIT_PreferenceMgr( QtxResourceMgr* resMgr, QWidget* parent )
 : QtxPagePrefMgr( resMgr, parent ),
-myRoot( 0 )
+myRoot( 0 ),
+myDeferred( false )
 {
 }
 
@@ -91,6 +207,79 @@ int SUIT_PreferenceMgr::addItem( const QString& title, const int pId,
   if ( item && item->depth() < 5 )
     return item->id();
 
+  if ( dynamic_cast<Descriptor*>( parent ) ||
+       ( myDeferred && isPage( parent ) && !myBuiltPages.contains( parent->id() ) ) )
+  {
+    // type of items is resolved automatically only for groups of pages
+    if ( type != Auto || isPage( parent ) )
+      item = new Descriptor( title, parent, type, sect, param );
+  }
+  else
+    item = createItem( title, parent, type, sect, param );
+
+  return item ? item->id() : -1;
+}
+
+void SUIT_PreferenceMgr::removeItem( const QString& title )
+{
+  if ( myRoot )
+  {
+    QtxPreferenceItem* item = myRoot->findItem( title, false );
+    if ( item ) {
+      QtxPagePrefMgr::removeItem( item );
+      delete item;
+    }
+  }
+}
+
+/*!
+  \brief Check if widgets of the pages are created only when pages are shown.
+*/
+bool SUIT_PreferenceMgr::isDeferred() const
+{
+  return myDeferred;
+}
+
+/*!
+  \brief Switch deferred creation of the pages contents on/off.
+
+  In deferred mode items added to the pages which have not been shown yet
+  are stored as descriptors; their widgets are created when the page is shown
+  for the first time. Items keep their identifiers, store() and retrieve()
+  work on descriptors as well.
+*/
+void SUIT_PreferenceMgr::setDeferred( const bool on )
+{
+  myDeferred = on;
+}
+
+/*!
+  \brief Create contents of the page when it is shown for the first time.
+*/
+void SUIT_PreferenceMgr::itemShown( QtxPagePrefItem* page )
+{
+  QtxPagePrefMgr::itemShown( page );
+
+  if ( !isPage( page ) || myBuiltPages.contains( page->id() ) )
+    return;
+
+  myBuiltPages.insert( page->id() );
+
+  QList<QtxPreferenceItem*> items;
+  buildItems( page, items );
+  if ( items.isEmpty() )
+    return;
+
+  for ( int i = items.count() - 1; i >= 0; i-- )
+    items.at( i )->updateContents();
+  page->updateContents();
+}
+
+QtxPreferenceItem* SUIT_PreferenceMgr::createItem( const QString& title, QtxPreferenceItem* parent,
+                                                   const SUIT_PreferenceMgr::PrefItemType type,
+                                                   const QString& sect, const QString& param )
+{
+  QtxPreferenceItem* item = 0;
   switch( type )
   {
   case Auto:
@@ -172,21 +361,71 @@ int SUIT_PreferenceMgr::addItem( const QString& title, const int pId,
     break;
   }
 
-  return item ? item->id() : -1;
+  return item;
 }
 
-void SUIT_PreferenceMgr::removeItem( const QString& title )
+/*!
+  \brief Replace descriptors among children of the item by the real items, recursively.
+  \param parent parent item
+  \param items created items, parents before children
+*/
+void SUIT_PreferenceMgr::buildItems( QtxPreferenceItem* parent, QList<QtxPreferenceItem*>& items )
 {
-  if ( myRoot )
+  QList<QtxPreferenceItem*> lst = parent->childItems();
+  for ( QList<QtxPreferenceItem*>::iterator it = lst.begin(); it != lst.end(); ++it )
   {
-    QtxPreferenceItem* item = myRoot->findItem( title, false );
-    if ( item ) {
-      QtxPagePrefMgr::removeItem( item );
-      delete item;
+    Descriptor* desc = dynamic_cast<Descriptor*>( *it );
+    if ( !desc )
+      continue;
+
+    QString sect, param;
+    desc->resource( sect, param );
+    QtxPreferenceItem* item = createItem( desc->title(), parent, desc->type(), sect, param );
+    if ( item )
+    {
+      // real item takes place and identifier of the descriptor
+      parent->insertItem( item, desc );
+      setItemId( item, desc->id() );
+      if ( !desc->icon().isNull() )
+        item->setIcon( desc->icon() );
+
+      const Descriptor::OptionList& opts = desc->options();
+      for ( Descriptor::OptionList::const_iterator itr = opts.begin(); itr != opts.end(); ++itr )
+        item->setOption( itr->first, itr->second );
+
+      if ( desc->isDefault() && resourceMgr() )
+      {
+        QtxResourceMgr::WorkingMode prev = resourceMgr()->setWorkingMode( QtxResourceMgr::IgnoreUserValues );
+        item->retrieveDefault();
+        resourceMgr()->setWorkingMode( prev );
+      }
+      else
+        item->retrieve();
+
+      QList<QtxPreferenceItem*> children = desc->childItems();
+      for ( QList<QtxPreferenceItem*>::iterator itr = children.begin(); itr != children.end(); ++itr )
+        item->insertItem( *itr );
+
+      items.append( item );
     }
+    delete desc;
+
+    if ( item )
+      buildItems( item, items );
   }
 }
 
+/*!
+  \brief Check if the item is a page, i.e. a frame in the tab widget.
+
+  Contents of pages are created on demand in deferred mode.
+*/
+bool SUIT_PreferenceMgr::isPage( const QtxPreferenceItem* item )
+{
+  return dynamic_cast<const QtxPagePrefFrameItem*>( item ) &&
+         dynamic_cast<const QtxPagePrefTabsItem*>( item->parentItem() );
+}
+
 QVariant SUIT_PreferenceMgr::optionValue( const QString& name ) const
 {
   QVariant val = QtxPagePrefMgr::optionValue( name );
@@ -30,10 +30,14 @@
 
 #include "QtxPagePrefMgr.h"
 
+#include <QSet>
+
 class SUIT_EXPORT SUIT_PreferenceMgr : public QtxPagePrefMgr
 {
   Q_OBJECT
 
+  class Descriptor;
+
 public:
   typedef enum { Auto, Space, Bool, Color, String, Selector,
                  DblSpin, IntSpin, Double, Integer,
@@ -55,13 +59,25 @@ public:
                               const QString& = QString(), const QString& = QString() );
   void               removeItem( const QString& );
 
+  bool               isDeferred() const;
+  void               setDeferred( const bool );
+
 protected:
   virtual QVariant   optionValue( const QString& ) const;
   virtual void       setOptionValue( const QString&, const QVariant& );
+  virtual void       itemShown( QtxPagePrefItem* );
   QtxPreferenceItem* root() const;
 
+private:
+  QtxPreferenceItem* createItem( const QString&, QtxPreferenceItem*, const PrefItemType,
+                                 const QString&, const QString& );
+  void               buildItems( QtxPreferenceItem*, QList<QtxPreferenceItem*>& );
+  static bool        isPage( const QtxPreferenceItem* );
+
 private:
   QtxPreferenceItem* myRoot;
+  bool               myDeferred;
+  QSet<int>          myBuiltPages;
 };
 
 #endif
@@ -0,0 +1,257 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+// CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+
+#include "SUIT_Profiler.h"
+
+#include <Qtx.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTextStream>
+
+namespace
+{
+  struct ProfilerData
+  {
+    ProfilerData() : enabled( false ), initialized( false ), maxEvents( 100000 ), nbEvents( 0 ), nbWritten( 0 ) { timer.start(); }
+
+    QElapsedTimer timer;
+    QString       fileName;
+    bool          enabled;
+    bool          initialized;
+    QList<int>    stack;      //!< indices of running events, -1 for events not recorded
+    QFile         file;       //!< trace file, opened on the first flush
+    int           maxEvents;  //!< maximum number of recorded events
+    int           nbEvents;   //!< number of events recorded since the trace file is set
+    int           nbWritten;  //!< number of events written to the trace file
+  };
+
+  ProfilerData& data()
+  {
+    static ProfilerData _data;
+    if ( !_data.initialized )
+    {
+      _data.initialized = true;
+      _data.fileName = Qtx::getenv( "SALOME_GUI_PROFILE" );
+      _data.enabled = !_data.fileName.isEmpty();
+    }
+    return _data;
+  }
+
+  QString escaped( const QString& str )
+  {
+    QString res = str;
+    res.replace( "\\", "\\\\" );
+    res.replace( "\"", "\\\"" );
+    return res;
+  }
+}
+
+/*!
+  \brief Constructor. Starts timing of the scope if profiling is switched on.
+  \param name scope name
+*/
+SUIT_Profiler::Scope::Scope( const QString& name )
+: myStarted( SUIT_Profiler::isEnabled() )
+{
+  if ( myStarted )
+    SUIT_Profiler::begin( name );
+}
+
+/*!
+  \brief Destructor. Finishes timing of the scope.
+*/
+SUIT_Profiler::Scope::~Scope()
+{
+  if ( myStarted )
+    SUIT_Profiler::end();
+}
+
+/*!
+  \return \c true if profiling is switched on
+*/
+bool SUIT_Profiler::isEnabled()
+{
+  return data().enabled;
+}
+
+/*!
+  \return name of the trace file
+*/
+QString SUIT_Profiler::fileName()
+{
+  return data().fileName;
+}
+
+/*!
+  \brief Sets name of the trace file; empty name switches profiling off.
+
+  The file is rewritten by the next flush, events count is reset.
+  \param name trace file name
+*/
+void SUIT_Profiler::setFileName( const QString& name )
+{
+  if ( data().file.isOpen() )
+    data().file.close();
+  data().nbEvents = data().nbWritten = 0;
+  data().fileName = name;
+  data().enabled = !name.isEmpty();
+}
+
+/*!
+  \return maximum number of events recorded to the trace file
+*/
+int SUIT_Profiler::maxEvents()
+{
+  return data().maxEvents;
+}
+
+/*!
+  \brief Sets maximum number of events recorded to the trace file.
+
+  Scopes started when the limit is reached are not recorded, so that
+  the trace file does not grow during the whole session.
+  \param num maximum number of events
+*/
+void SUIT_Profiler::setMaxEvents( const int num )
+{
+  data().maxEvents = qMax( num, 0 );
+}
+
+/*!
+  \return number of events recorded since the trace file is set
+*/
+int SUIT_Profiler::nbEvents()
+{
+  return data().nbEvents;
+}
+
+/*!
+  \brief Starts timed scope, nested in the current one if any.
+  \param name scope name
+*/
+void SUIT_Profiler::begin( const QString& name )
+{
+  if ( !isEnabled() )
+    return;
+
+  if ( data().nbEvents >= data().maxEvents )
+  {
+    data().stack.append( -1 );
+    return;
+  }
+
+  Event e;
+  e.name = name;
+  e.start = data().timer.nsecsElapsed() / 1000;
+  e.duration = -1;
+  e.depth = data().stack.count();
+
+  data().stack.append( events().count() );
+  data().nbEvents++;
+  events().append( e );
+}
+
+/*!
+  \brief Finishes current timed scope.
+
+  When the outermost scope is finished, its events are written to the trace file.
+*/
+void SUIT_Profiler::end()
+{
+  if ( data().stack.isEmpty() )
+    return;
+
+  int index = data().stack.takeLast();
+  if ( index >= 0 )
+  {
+    Event& e = events()[index];
+    e.duration = data().timer.nsecsElapsed() / 1000 - e.start;
+  }
+
+  if ( data().stack.isEmpty() && isEnabled() )
+    flush();
+}
+
+/*!
+  \brief Appends finished events to the trace file and removes them from memory.
+
+  Events are written as JSON array of Chrome trace event format, which
+  may be left unterminated: the file is valid after each flush.
+
+  If the trace file can not be opened, the events are discarded and
+  profiling is switched off, so that they do not accumulate in memory.
+  \return \c true if events have been written
+*/
+bool SUIT_Profiler::flush()
+{
+  if ( !data().stack.isEmpty() )
+    return false;
+
+  QFile& file = data().file;
+  bool opened = !file.isOpen();
+  if ( opened )
+  {
+    file.setFileName( fileName() );
+    if ( !file.open( QFile::WriteOnly | QFile::Truncate | QFile::Text ) )
+    {
+      events().clear();
+      data().enabled = false;
+      return false;
+    }
+  }
+
+  qint64 pid = QCoreApplication::applicationPid();
+
+  QTextStream out( &file );
+  if ( opened )
+    out << "[";
+  foreach ( const Event& e, events() )
+  {
+    out << ( data().nbWritten++ ? ",\n" : "\n" )
+        << "{\"name\":\"" << escaped( e.name ) << "\",\"ph\":\"X\""
+        << ",\"ts\":" << e.start << ",\"dur\":" << e.duration
+        << ",\"pid\":" << pid << ",\"tid\":0"
+        << ",\"args\":{\"depth\":" << e.depth << "}}";
+  }
+  out.flush();
+  events().clear();
+
+  return file.flush() && file.error() == QFile::NoError;
+}
+
+/*!
+  \brief Removes all finished events not written yet.
+*/
+void SUIT_Profiler::clear()
+{
+  if ( data().stack.isEmpty() )
+    events().clear();
+}
+
+/*!
+  \return recorded events not written yet
+*/
+QList<SUIT_Profiler::Event>& SUIT_Profiler::events()
+{
+  static QList<Event> _events;
+  return _events;
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+// CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+
+#ifndef SUIT_PROFILER_H
+#define SUIT_PROFILER_H
+
+#include "SUIT.h"
+
+#include <QList>
+#include <QString>
+
+/*!
+  \class SUIT_Profiler
+  \brief Records timeline of the application startup and other long actions.
+
+  Profiling is switched on by SALOME_GUI_PROFILE environment variable
+  which gives the name of the trace file. Timed scopes can be nested;
+  each time the outermost scope is finished, its events are appended
+  to the trace file in Chrome trace event format (it can be loaded to
+  chrome://tracing or Perfetto UI) and removed from memory. Recording
+  stops after maxEvents() events.
+
+  Should be used from the GUI thread only.
+*/
+class SUIT_EXPORT SUIT_Profiler
+{
+public:
+  /*!
+    \class Scope
+    \brief Times the code block in which it is declared.
+  */
+  class SUIT_EXPORT Scope
+  {
+  public:
+    Scope( const QString& );
+    ~Scope();
+
+  private:
+    bool myStarted;
+  };
+
+  static bool    isEnabled();
+  static QString fileName();
+  static void    setFileName( const QString& );
+
+  static void    begin( const QString& );
+  static void    end();
+
+  static int     maxEvents();
+  static void    setMaxEvents( const int );
+  static int     nbEvents();
+
+  static bool    flush();
+  static void    clear();
+
+private:
+  struct Event
+  {
+    QString name;
+    qint64  start;    //!< start time, microseconds
+    qint64  duration; //!< duration, microseconds, -1 while running
+    int     depth;    //!< nesting level
+  };
+
+  static QList<Event>& events();
+};
+
+#endif
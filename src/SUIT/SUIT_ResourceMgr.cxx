@@ -36,7 +36,8 @@
     Constructor
 */
 SUIT_ResourceMgr::SUIT_ResourceMgr( const QString& app, const QString& resVarTemplate )
-: QtxResourceMgr( app, resVarTemplate )
+: QtxResourceMgr( app, resVarTemplate ),
+  myCacheEnabled( Qtx::getenv( "SUIT_NO_RESOURCES_CACHE" ).isEmpty() )
 {
 }
 
@@ -63,6 +64,42 @@ void SUIT_ResourceMgr::setVersion( const QString& ver )
   myVersion = ver;
 }
 
+/*!
+    Returns the directory of binary cache of the global resources files:
+    unless other directory is set, cache is kept next to the user preferences file.
+    Null string is returned if cache is disabled.
+*/
+QString SUIT_ResourceMgr::cacheDir() const
+{
+  if ( !isCacheEnabled() )
+    return QString();
+
+  QString dir = QtxResourceMgr::cacheDir();
+  if ( dir.isEmpty() && !appName().isEmpty() )
+  {
+    QFileInfo userFile( userFileName( appName(), false ) );
+    dir = QDir( userFile.absolutePath() ).filePath( QString( ".%1_cache" ).arg( appName() ) );
+  }
+  return dir;
+}
+
+/*!
+    Returns true if binary cache of the global resources files is used.
+    Cache can be disabled by setting SUIT_NO_RESOURCES_CACHE environment variable.
+*/
+bool SUIT_ResourceMgr::isCacheEnabled() const
+{
+  return myCacheEnabled;
+}
+
+/*!
+    Enables/disables binary cache of the global resources files
+*/
+void SUIT_ResourceMgr::setCacheEnabled( const bool on )
+{
+  myCacheEnabled = on;
+}
+
 /*!
     Loads a doc page from 'prefix' resources and indetified by 'id'
 */
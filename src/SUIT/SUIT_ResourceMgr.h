@@ -38,6 +38,10 @@ public:
 
   QString         loadDoc( const QString&, const QString& ) const;
 
+  virtual QString cacheDir() const;
+  bool            isCacheEnabled() const;
+  void            setCacheEnabled( const bool );
+
 protected:
   virtual QString userFileName( const QString&, const bool = true ) const;
   virtual QString findAppropriateUserFile( const QString& ) const;
@@ -46,6 +50,7 @@ protected:
 
 private:
   QString         myVersion;
+  bool            myCacheEnabled;
 };
 
 #endif
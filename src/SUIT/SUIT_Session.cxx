@@ -26,6 +26,7 @@
 #include "SUIT_Tools.h"
 #include "SUIT_MessageBox.h"
 #include "SUIT_ExceptionHandler.h"
+#include "SUIT_Profiler.h"
 #include "SUIT_ResourceMgr.h"
 
 #include <QApplication>
@@ -81,6 +82,8 @@ SUIT_Session* SUIT_Session::session()
 
 SUIT_Application* SUIT_Session::startApplication( const QString& name, int /*args*/, char** /*argv*/ )
 {
+  SUIT_Profiler::Scope aScope( QString( "start application %1" ).arg( name ) );
+
   AppLib libHandle = 0;
 
   QString appName = applicationName( name );
@@ -89,7 +92,10 @@ SUIT_Application* SUIT_Session::startApplication( const QString& name, int /*arg
 
   QString lib;
   if ( !libHandle )
+  {
+    SUIT_Profiler::Scope aLibScope( "load application library" );
     libHandle = loadLibrary( name, lib );
+  }
 
   if ( !libHandle )
   {
@@ -119,12 +125,17 @@ SUIT_Application* SUIT_Session::startApplication( const QString& name, int /*arg
   // Prepare Resource Manager for the new application if it doesn't exist yet
   if ( !myResMgr )
   {
+    SUIT_Profiler::Scope aResScope( "resources" );
     myResMgr = createResourceMgr( appName );
     myResMgr->loadLanguage();
   }
 
   //jfa 22.06.2005:SUIT_Application* anApp = crtInst( args, argv );
-  SUIT_Application* anApp = crtInst();
+  SUIT_Application* anApp = 0;
+  {
+    SUIT_Profiler::Scope anAppScope( "create application" );
+    anApp = crtInst();
+  }
   if ( !anApp )
   {
     SUIT_MessageBox::warning( 0, tr( "Error" ), tr( "Can not create application \"%1\": %2").arg( appName ).arg( lastError() ) );
@@ -147,7 +158,10 @@ SUIT_Application* SUIT_Session::startApplication( const QString& name, int /*arg
       myHandler = crtHndlr();
   }
 
-  anApp->start();
+  {
+    SUIT_Profiler::Scope aStartScope( "start" );
+    anApp->start();
+  }
 
   // Application can be closed during starting (not started).
   if ( !myAppList.contains( anApp ) )
@@ -546,7 +546,7 @@ void SUIT_ShortcutTabWidget::updateTabs(bool theHighlightModifiedTreeItems, bool
       itModuleIDAndTree = myModuleTrees.emplace(moduleID, moduleTree).first;
 
       const int tabIndex = ::SUIT_tools::distanceFromBegin(myModuleIDs, myModuleIDs.find(moduleID));
-      insertTab(tabIndex + 1 /*The first tab is SUIT_FindActionWidget.*/, moduleTree, moduleAssets->myIcon, moduleTree->name());
+      insertTab(tabIndex + 1 /*The first tab is SUIT_FindActionWidget.*/, moduleTree, moduleAssets->ownIcon(), moduleTree->name());
     }
 
     SUIT_ShortcutTree* const moduleTree = itModuleIDAndTree->second;
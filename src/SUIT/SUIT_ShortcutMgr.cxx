@@ -40,6 +40,7 @@
 #include <QJsonArray>
 #include <QJsonParseError>
 #include <QFile>
+#include <QElapsedTimer>
 
 #include <list>
 #include <iostream>
@@ -75,6 +76,15 @@ void Warning(const char* src)
   //std::wcout << std::wstring(src, src + strlen(src)) << std::endl;
 }
 
+/*! \brief Prints time spent on theStage to the debug output,
+if SUIT_SHORTCUTS_TIMING environment variable is set to a non-empty value. */
+static void ShCutTiming(const QString& theStage, const QElapsedTimer& theTimer)
+{
+  static const bool isTimingOn = !qgetenv("SUIT_SHORTCUTS_TIMING").isEmpty();
+  if (isTimingOn)
+    qDebug() << "SUIT_ShortcutMgr:" << theStage << "in" << theTimer.nsecsElapsed() / 1000 << "us";
+}
+
 
 static const QKeySequence NO_KEYSEQUENCE = QKeySequence(QString(""));
 static const QString NO_ACTION = QString("");
@@ -93,6 +103,116 @@ const QString LANG_SECTION = QString("language");
 static const QString SECTION_NAME_ACTION_ASSET_FILE_PATHS = QString("action_assets");
 
 
+/*! \brief Skips whitespaces, starting from theIdx. */
+static void skipJSONWhitespaces(const QByteArray& theJSON, int& theIdx)
+{
+  while (theIdx < theJSON.size() && (theJSON[theIdx] == ' ' || theJSON[theIdx] == '\t' || theJSON[theIdx] == '\n' || theJSON[theIdx] == '\r'))
+    theIdx++;
+}
+
+/*! \brief Skips JSON string, starting from opening quote at theIdx.
+\returns false, if the string is not terminated. */
+static bool skipJSONString(const QByteArray& theJSON, int& theIdx)
+{
+  for (theIdx++; theIdx < theJSON.size(); theIdx++) {
+    if (theJSON[theIdx] == '\\')
+      theIdx++;
+    else if (theJSON[theIdx] == '"') {
+      theIdx++;
+      return true;
+    }
+  }
+  return false;
+}
+
+/*! \brief Skips JSON value, starting from its first character at theIdx. The value is not validated, only brackets are matched.
+\returns false, if the value is not terminated. */
+static bool skipJSONValue(const QByteArray& theJSON, int& theIdx)
+{
+  int depth = 0;
+  while (theIdx < theJSON.size()) {
+    const char c = theJSON[theIdx];
+    if (c == '"') {
+      if (!skipJSONString(theJSON, theIdx))
+        return false;
+    }
+    else {
+      if (c == '{' || c == '[')
+        depth++;
+      else if (c == '}' || c == ']') {
+        if (depth == 0)
+          return true; // End of enclosing object.
+        depth--;
+      }
+      else if (c == ',' && depth == 0)
+        return true;
+
+      theIdx++;
+    }
+
+    if (depth == 0 && (c == '}' || c == ']' || c == '"'))
+      return true;
+  }
+  return false;
+}
+
+/*! \brief Finds members of top-level JSON object without parsing their values.
+\param oMembers { key, { offset, size } }[] - location of member values in theJSON. If a key is duplicated, the last member is taken.
+\returns false, if theJSON is not an object or is malformed. */
+static bool indexJSONObjectMembers(const QByteArray& theJSON, std::map<QString, std::pair<qint64, qint64>>& oMembers)
+{
+  int idx = 0;
+  skipJSONWhitespaces(theJSON, idx);
+  if (idx == theJSON.size() || theJSON[idx] != '{')
+    return false;
+
+  idx++;
+  skipJSONWhitespaces(theJSON, idx);
+  if (idx < theJSON.size() && theJSON[idx] == '}')
+    return true;
+
+  while (idx < theJSON.size()) {
+    if (theJSON[idx] != '"')
+      return false;
+
+    const int keyStart = idx;
+    if (!skipJSONString(theJSON, idx))
+      return false;
+
+    const QByteArray rawKey = theJSON.mid(keyStart + 1, idx - keyStart - 2);
+    QString key;
+    if (rawKey.contains('\\')) // Let Qt unescape the key.
+      key = QJsonDocument::fromJson("[" + theJSON.mid(keyStart, idx - keyStart) + "]").array().at(0).toString();
+    else
+      key = QString::fromUtf8(rawKey);
+
+    skipJSONWhitespaces(theJSON, idx);
+    if (idx == theJSON.size() || theJSON[idx] != ':')
+      return false;
+
+    idx++;
+    skipJSONWhitespaces(theJSON, idx);
+    const int valueStart = idx;
+    if (!skipJSONValue(theJSON, idx))
+      return false;
+
+    oMembers[key] = std::pair<qint64, qint64>(valueStart, idx - valueStart);
+
+    skipJSONWhitespaces(theJSON, idx);
+    if (idx == theJSON.size())
+      return false;
+    else if (theJSON[idx] == '}')
+      return true;
+    else if (theJSON[idx] != ',')
+      return false;
+
+    idx++;
+    skipJSONWhitespaces(theJSON, idx);
+  }
+  return false;
+}
+
+
 
 /** Uncomment this to enable DevTools. */
 // #define SHORTCUT_MGR_DEVTOOLS
@@ -914,7 +1034,7 @@ void SUIT_ShortcutAssets::LangDependentAssets::toJSON(QJsonObject& oJsonObject)
 /*static*/ const QString SUIT_ShortcutAssets::PROP_ID_CHILDREN = "children";
 
 SUIT_ShortcutAssets::SUIT_ShortcutAssets(const QString& theModuleID)
-: myModuleID(theModuleID)
+: myModuleID(theModuleID), myIconIsLoaded(false)
 {
   if (!SUIT_ShortcutMgr::isModuleIDValid(myModuleID))
     throw std::invalid_argument("SUIT_ShortcutAssets: invalid module ID \"" + myModuleID.toStdString() + "\".");
@@ -1099,10 +1219,11 @@ void SUIT_ShortcutAssets::merge(const SUIT_ShortcutAssets& theOther, bool theOve
       thisLDA.myToolTip = otherLDA.myToolTip;
   }
 
-  if (myIconPath.isEmpty() || theOverride && !theOther.myIconPath.isEmpty()) {
+  if ((myIconPath.isEmpty() || theOverride && !theOther.myIconPath.isEmpty()) && myIconPath != theOther.myIconPath) {
     myIconPath = theOther.myIconPath;
-    if (!myIcon.isNull())
-      loadIcon(true /*theReload*/);
+    // The new icon is decoded on demand.
+    myIcon = QIcon();
+    myIconIsLoaded = false;
   }
 
   for (const auto& otherChildIDLTAndChild : theOther.myChildren) {
@@ -1154,14 +1275,10 @@ void SUIT_ShortcutAssets::merge(SUIT_ShortcutAssets&& theOther, bool theOverride
     itOtherLangAndLDA++;
   }
 
-  if (myIconPath.isEmpty() || theOverride && !theOther.myIconPath.isEmpty()) {
+  if ((myIconPath.isEmpty() || theOverride && !theOther.myIconPath.isEmpty()) && myIconPath != theOther.myIconPath) {
     myIconPath = std::move(theOther.myIconPath);
-    if (!myIcon.isNull()) {
-      if (theOther.myIcon.isNull())
-        loadIcon(true /*theReload*/);
-      else
-        myIcon = std::move(theOther.myIcon);
-    }
+    myIconIsLoaded = theOther.myIconIsLoaded;
+    myIcon = myIconIsLoaded ? std::move(theOther.myIcon) : QIcon();
   }
 
   for (auto itOtherChildIDLTAndChild = theOther.myChildren.begin(); itOtherChildIDLTAndChild != theOther.myChildren.end(); ) {
@@ -1187,6 +1304,19 @@ void SUIT_ShortcutAssets::loadIcon(bool theReload)
 {
   if (!myIconPath.isEmpty() && (myIcon.isNull() || theReload))
     myIcon = QIcon(::SUIT_tools::substituteVars(myIconPath));
+
+  myIconIsLoaded = true;
+}
+
+const QIcon& SUIT_ShortcutAssets::ownIcon() const
+{
+  if (!myIconIsLoaded) {
+    if (myIcon.isNull() && !myIconPath.isEmpty())
+      myIcon = QIcon(::SUIT_tools::substituteVars(myIconPath));
+
+    myIconIsLoaded = true;
+  }
+  return myIcon;
 }
 
 void SUIT_ShortcutAssets::forEachDescendant(const std::function<void(SUIT_ShortcutItemAssets&)>& theFunc) const
@@ -1499,7 +1629,8 @@ QString SUIT_ShortcutItemAssets::actionID() const
 
 const QIcon& SUIT_ShortcutItemAssets::icon() const
 {
-  if (myIcon.isNull()) {
+  const QIcon& ownIcon = SUIT_ShortcutAssets::ownIcon();
+  if (ownIcon.isNull()) {
     if (myIsAction) {
       if (children().empty())
         return SUIT_ShortcutItemAssets::DEFAUT_ICON_ACTION;
@@ -1510,7 +1641,7 @@ const QIcon& SUIT_ShortcutItemAssets::icon() const
       return SUIT_ShortcutItemAssets::DEFAUT_ICON_FOLDER;
   }
   else
-    return myIcon;
+    return ownIcon;
 }
 
 
@@ -1533,11 +1664,22 @@ SUIT_ShortcutMgr::~SUIT_ShortcutMgr()
 {
   if( myShortcutMgr == nullptr) {
     ShCutDbg("SUIT_ShortcutMgr initialization has started.");
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+
     myShortcutMgr = new SUIT_ShortcutMgr();
+
+    QElapsedTimer timer;
+    timer.start();
     myShortcutMgr->setAssetsFromResources();
+    ShCutTiming("asset files indexed", timer);
+
+    timer.restart();
     myShortcutMgr->setShortcutsFromPreferences();
+    ShCutTiming("shortcuts retrieved from preferences", timer);
 
     { // Migrate old shortcut preferences.
+      timer.restart();
       SUIT_ShortcutHistorian historian;
       myShortcutMgr->mergeShortcutContainer(
         historian.getContainerWithOldShortcuts(),
@@ -1547,8 +1689,10 @@ SUIT_ShortcutMgr::~SUIT_ShortcutMgr()
       );
 
       historian.removeOldShortcutPreferences();
+      ShCutTiming("old shortcut preferences migrated", timer);
     }
 
+    ShCutTiming("initialized", totalTimer);
     ShCutDbg("SUIT_ShortcutMgr initialization has finished.");
   }
 }
@@ -2305,6 +2449,8 @@ std::set<QString> SUIT_ShortcutMgr::getIDsOfInterferingModules(const QString& th
 
 std::shared_ptr<const SUIT_ShortcutModuleAssets> SUIT_ShortcutMgr::getModuleAssets(const QString& theModuleID) const
 {
+  loadModuleAssets(theModuleID);
+
   const auto itModuleAssets = myModuleAssets.find(theModuleID);
   if (itModuleAssets == myModuleAssets.end())
     return std::shared_ptr<const SUIT_ShortcutModuleAssets>(nullptr);
@@ -2312,6 +2458,14 @@ std::shared_ptr<const SUIT_ShortcutModuleAssets> SUIT_ShortcutMgr::getModuleAsse
   return itModuleAssets->second;
 }
 
+const std::map<QString, std::shared_ptr<SUIT_ShortcutModuleAssets>>& SUIT_ShortcutMgr::getModuleAssets() const
+{
+  while (!myAssetIndex.empty())
+    loadModuleAssets(myAssetIndex.begin()->first);
+
+  return myModuleAssets;
+}
+
 QString SUIT_ShortcutMgr::getModuleName(const QString& theModuleID, const QString& theLang) const
 {
   const auto assets = getModuleAssets(theModuleID);
@@ -2342,6 +2496,8 @@ std::shared_ptr<const SUIT_ShortcutItemAssets> SUIT_ShortcutMgr::getActionAssets
     return std::shared_ptr<const SUIT_ShortcutItemAssets>(nullptr);
   }
 
+  loadModuleAssets(moduleID);
+
   auto itModuleAssets = myModuleAssets.find(moduleID);
   if (itModuleAssets != myModuleAssets.end()) {
     const std::shared_ptr<const SUIT_ShortcutModuleAssets> moduleAssets = itModuleAssets->second;
@@ -2448,7 +2604,7 @@ QtxAction* SUIT_ShortcutMgr::createAction(QObject* theParent, QObject* theReceiv
     action = new QtxAction(theParent, theIsToggle, theActionID, inModuleID, lastTokenOfID, QIcon());
   }
   else {
-    action = new QtxAction(theParent, theIsToggle, theActionID, actionAssets->bestToolTip(), actionAssets->bestName(), actionAssets->myIcon);
+    action = new QtxAction(theParent, theIsToggle, theActionID, actionAssets->bestToolTip(), actionAssets->bestName(), actionAssets->ownIcon());
   }
 
   if (theReceiver && theReceiverMemberMethod)
@@ -2615,6 +2771,8 @@ void SUIT_ShortcutMgr::setShortcutsFromPreferences()
   SUIT_ShortcutMgr::fillContainerFromPreferences(container, false /*theDefaultOnly*/);
   mergeShortcutContainer(container, true /*theOverride*/, false /*theTreatAbsentIncomingAsDisabled*/, false /*theSaveToPreferences*/);
 
+#ifdef SHORTCUT_MGR_DBG
+  // Checking assets of all shortcuts requires parsing of assets of all modules. Do it only if debugging.
   if (myAssetsLoaded) {
     // Warn, if some action assets are not provided.
     const auto moduleIDs = myShortcutContainer.getIDsOfAllModules();
@@ -2630,6 +2788,7 @@ void SUIT_ShortcutMgr::setShortcutsFromPreferences()
   }
   else
     Warning("SUIT_ShortcutMgr: loading of shortcuts from preferences happened earlier, than loading of asset files.");
+#endif //SHORTCUT_MGR_DBG
 
   ShCutDbg() && ShCutDbg("Retrieving shortcuts from preferences has finished.");
 }
@@ -2690,8 +2849,7 @@ void SUIT_ShortcutMgr::setShortcutsFromPreferences()
 
 void SUIT_ShortcutMgr::setAssetsFromResources(QString theLanguage)
 {
-  ShCutDbg() && ShCutDbg("Retrieving shortcut assets.");
-  static const std::function<void(SUIT_ShortcutAssets&)> loadIcon = [] (SUIT_ShortcutAssets& theAssets) { theAssets.loadIcon(); };
+  ShCutDbg() && ShCutDbg("Indexing shortcut assets.");
 
   SUIT_ResourceMgr* resMgr = SUIT_Session::session()->resourceMgr();
   if (!resMgr) {
@@ -2704,7 +2862,7 @@ void SUIT_ShortcutMgr::setAssetsFromResources(QString theLanguage)
 
   ShCutDbg("Requested asset language is \"" + theLanguage + "\".");
 
-  const auto langs = std::set<QString>({ DEFAULT_LANG, theLanguage });
+  myAssetLangs = std::set<QString>({ DEFAULT_LANG, theLanguage });
 
   QStringList actionAssetFilePaths = resMgr->parameters(SECTION_NAME_ACTION_ASSET_FILE_PATHS);
 #ifdef SHORTCUT_MGR_DBG
@@ -2712,96 +2870,31 @@ void SUIT_ShortcutMgr::setAssetsFromResources(QString theLanguage)
 #endif
   for (const QString& actionAssetFilePath : actionAssetFilePaths) {
     const QString path = ::SUIT_tools::substituteVars(actionAssetFilePath);
-    ShCutDbg("Parsing asset file \"" + path + "\".");
+    ShCutDbg("Indexing asset file \"" + path + "\".");
     QFile actionAssetFile(path);
     if (!actionAssetFile.open(QIODevice::ReadOnly)) {
       Warning("SUIT_ShortcutMgr can't open action asset file \"" + path + "\"!");
       continue;
     }
 
-    QJsonParseError jsonError;
-    QJsonDocument document = QJsonDocument::fromJson(actionAssetFile.readAll(), &jsonError);
+    const QByteArray content = actionAssetFile.readAll();
     actionAssetFile.close();
-    if (jsonError.error != QJsonParseError::NoError) {
+
+    std::map<QString, std::pair<qint64, qint64>> moduleLocations;
+    if (!::indexJSONObjectMembers(content, moduleLocations)) {
       Warning("SUIT_ShortcutMgr: error during parsing of action asset file \"" + path + "\"!");
       continue;
     }
 
-    if (document.isObject()) {
-      QJsonObject documentJSONObject = document.object();
-      for (const QString& moduleID : documentJSONObject.keys()) {
-        if (!SUIT_ShortcutMgr::isModuleIDValid(moduleID)) {
-          ShCutDbg("Action asset file \"" + path + "\" contains invalid module ID \"" + moduleID + "\".");
-          continue;
-        }
-
-        const auto& moduleJSONValue = documentJSONObject[moduleID];
-        if (!moduleJSONValue.isObject()) {
-          ShCutDbg("Action asset file \"" + path + "\" contains invalid value with module ID \"" + moduleID + "\".");
-          continue;
-        }
-
-        const auto parsedModuleAssets = SUIT_ShortcutModuleAssets::create(moduleID);
-        if (!parsedModuleAssets->fromJSON(moduleJSONValue.toObject(), true /*theParseDescendants*/, langs)) {
-          ShCutDbg("Action asset file \"" + path + "\" contains invalid/empty assets of module with ID \"" + moduleID + "\".");
-          continue;
-        }
-
-        auto itModuleAssets = myModuleAssets.find(moduleID);
-        if (itModuleAssets == myModuleAssets.end()) {
-          itModuleAssets = myModuleAssets.emplace(moduleID, std::move(parsedModuleAssets)).first;
-          SUIT_ShortcutModuleAssets& moduleAssets = *(itModuleAssets->second);
-
-          moduleAssets.loadIcon();
-          moduleAssets.forEachDescendant(loadIcon);
-
-          { // Fill default assets of module itself, not its actions/folders. The default assets are overriden by assets in files.
-            if (moduleID == SUIT_ShortcutMgr::ROOT_MODULE_ID) {
-              if (moduleAssets.myLangDependentAssets.find(DEFAULT_LANG) == moduleAssets.myLangDependentAssets.end()) {
-                auto& lda = moduleAssets.myLangDependentAssets[DEFAULT_LANG];
-                lda.myName = tr("General");
-              }
-
-              if (moduleAssets.myIconPath.isEmpty()) {
-                QString dirPath;
-                if (resMgr->value("resources", "LightApp", dirPath))
-                  moduleAssets.myIconPath = dirPath + (!dirPath.isEmpty() && dirPath.back() == "/" ? "" : "/") + "icon_default.png";
-              }
-
-              if (moduleAssets.myIcon.isNull())
-                moduleAssets.myIcon = QIcon(::SUIT_tools::substituteVars(moduleAssets.myIconPath));
-            }
-            else /* if module is not root module */ {
-              if (moduleAssets.myLangDependentAssets.find(DEFAULT_LANG) == moduleAssets.myLangDependentAssets.end()) {
-                auto& lda = moduleAssets.myLangDependentAssets[DEFAULT_LANG];
-
-                QString moduleName = moduleID;
-                resMgr->value(moduleID, "name", moduleName);
-                lda.myName = moduleName;
-
-                resMgr->value(moduleID, "description", lda.myToolTip);
-              }
-
-              if (moduleAssets.myIconPath.isEmpty()) {
-                QString dirPath;
-                QString fileName;
-                if (resMgr->value("resources", moduleID, dirPath) && resMgr->value(moduleID, "icon", fileName))
-                  moduleAssets.myIconPath = dirPath + (!dirPath.isEmpty() && dirPath.back() == "/" ? "" : "/") + fileName;
-              }
-
-              if (moduleAssets.myIcon.isNull())
-                moduleAssets.myIcon = QIcon(::SUIT_tools::substituteVars(moduleAssets.myIconPath));
-            }
-          }
-        }
-        else /* if assets of the module have already been added */ {
-          SUIT_ShortcutModuleAssets& moduleAssets = *(itModuleAssets->second);
-
-          moduleAssets.merge(std::move(*parsedModuleAssets), true);
-          moduleAssets.loadIcon();
-          moduleAssets.forEachDescendant(loadIcon);
-        }
+    for (const auto& moduleIDAndLocation : moduleLocations) {
+      const QString& moduleID = moduleIDAndLocation.first;
+      if (!SUIT_ShortcutMgr::isModuleIDValid(moduleID)) {
+        ShCutDbg("Action asset file \"" + path + "\" contains invalid module ID \"" + moduleID + "\".");
+        continue;
       }
+
+      // If assets of the module have already been parsed, the location is merged into them on next request.
+      myAssetIndex[moduleID].push_back({path, moduleIDAndLocation.second.first, moduleIDAndLocation.second.second});
     }
   }
 
@@ -2810,7 +2903,7 @@ void SUIT_ShortcutMgr::setAssetsFromResources(QString theLanguage)
 #ifdef SHORTCUT_MGR_DBG
   ShCutDbg("All assets: ");
   QJsonObject moduleJSONObject;
-  for (const auto& moduleIDAndAssets : myModuleAssets) {
+  for (const auto& moduleIDAndAssets : getModuleAssets()) {
     moduleIDAndAssets.second->toJSON(moduleJSONObject);
     QJsonDocument doc(moduleJSONObject);
     QString strJson = doc.toJson(QJsonDocument::Indented);
@@ -2819,6 +2912,98 @@ void SUIT_ShortcutMgr::setAssetsFromResources(QString theLanguage)
 #endif
 }
 
+void SUIT_ShortcutMgr::loadModuleAssets(const QString& theModuleID) const
+{
+  const auto itIndex = myAssetIndex.find(theModuleID);
+  if (itIndex == myAssetIndex.end())
+    return;
+
+  QElapsedTimer timer;
+  timer.start();
+
+  // Erase the entry beforehand: parsing must not be attempted again, even if it fails.
+  const std::vector<SUIT_ShortcutMgr::AssetLocation> locations = std::move(itIndex->second);
+  myAssetIndex.erase(itIndex);
+
+  for (const auto& location : locations) {
+    ShCutDbg("Parsing assets of module \"" + theModuleID + "\" in asset file \"" + location.myFilePath + "\".");
+    QFile actionAssetFile(location.myFilePath);
+    if (!actionAssetFile.open(QIODevice::ReadOnly) || !actionAssetFile.seek(location.myOffset)) {
+      Warning("SUIT_ShortcutMgr can't open action asset file \"" + location.myFilePath + "\"!");
+      continue;
+    }
+
+    const QByteArray content = actionAssetFile.read(location.mySize);
+    actionAssetFile.close();
+
+    QJsonParseError jsonError;
+    const QJsonDocument document = QJsonDocument::fromJson(content, &jsonError);
+    if (jsonError.error != QJsonParseError::NoError || !document.isObject()) {
+      ShCutDbg("Action asset file \"" + location.myFilePath + "\" contains invalid value with module ID \"" + theModuleID + "\".");
+      continue;
+    }
+
+    const auto parsedModuleAssets = SUIT_ShortcutModuleAssets::create(theModuleID);
+    if (!parsedModuleAssets->fromJSON(document.object(), true /*theParseDescendants*/, myAssetLangs)) {
+      ShCutDbg("Action asset file \"" + location.myFilePath + "\" contains invalid/empty assets of module with ID \"" + theModuleID + "\".");
+      continue;
+    }
+
+    auto itModuleAssets = myModuleAssets.find(theModuleID);
+    if (itModuleAssets == myModuleAssets.end()) {
+      itModuleAssets = myModuleAssets.emplace(theModuleID, std::move(parsedModuleAssets)).first;
+      SUIT_ShortcutMgr::setDefaultModuleAssets(*(itModuleAssets->second));
+    }
+    else /* if assets of the module have already been added */ {
+      SUIT_ShortcutModuleAssets& moduleAssets = *(itModuleAssets->second);
+      moduleAssets.merge(std::move(*parsedModuleAssets), true);
+    }
+  }
+
+  ShCutTiming("assets of module \"" + theModuleID + "\" parsed", timer);
+}
+
+/*static*/ void SUIT_ShortcutMgr::setDefaultModuleAssets(SUIT_ShortcutModuleAssets& theModuleAssets)
+{
+  SUIT_ResourceMgr* resMgr = SUIT_Session::session()->resourceMgr();
+  if (!resMgr) {
+    Warning("SUIT_ShortcutMgr can't retrieve resource manager!");
+    return;
+  }
+
+  const QString& moduleID = theModuleAssets.myModuleID;
+  if (moduleID == SUIT_ShortcutMgr::ROOT_MODULE_ID) {
+    if (theModuleAssets.myLangDependentAssets.find(DEFAULT_LANG) == theModuleAssets.myLangDependentAssets.end()) {
+      auto& lda = theModuleAssets.myLangDependentAssets[DEFAULT_LANG];
+      lda.myName = tr("General");
+    }
+
+    if (theModuleAssets.myIconPath.isEmpty()) {
+      QString dirPath;
+      if (resMgr->value("resources", "LightApp", dirPath))
+        theModuleAssets.myIconPath = dirPath + (!dirPath.isEmpty() && dirPath.back() == "/" ? "" : "/") + "icon_default.png";
+    }
+  }
+  else /* if module is not root module */ {
+    if (theModuleAssets.myLangDependentAssets.find(DEFAULT_LANG) == theModuleAssets.myLangDependentAssets.end()) {
+      auto& lda = theModuleAssets.myLangDependentAssets[DEFAULT_LANG];
+
+      QString moduleName = moduleID;
+      resMgr->value(moduleID, "name", moduleName);
+      lda.myName = moduleName;
+
+      resMgr->value(moduleID, "description", lda.myToolTip);
+    }
+
+    if (theModuleAssets.myIconPath.isEmpty()) {
+      QString dirPath;
+      QString fileName;
+      if (resMgr->value("resources", moduleID, dirPath) && resMgr->value(moduleID, "icon", fileName))
+        theModuleAssets.myIconPath = dirPath + (!dirPath.isEmpty() && dirPath.back() == "/" ? "" : "/") + fileName;
+    }
+  }
+}
+
 void SUIT_ShortcutMgr::registerAnonymousShortcut(QAction* const theAction)
 {
   const auto itAnSh = myAnonymousShortcuts.find(theAction);
@@ -34,6 +34,7 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <vector>
 #include <limits>
 #include <functional>
 
@@ -242,8 +243,14 @@ private:
   virtual void toJSONVirtual(QJsonObject& oJsonObject) const {};
 
 public:
+  /*! \brief Decodes myIconPath into myIcon.
+  \param theReload If false, the icon is not decoded again, if it has been decoded. */
   void loadIcon(bool theReload = false);
 
+  /*! \brief Icon of the assets. myIconPath is decoded on first call, since most of icons are never displayed.
+  \returns Null icon, if myIconPath is empty or invalid and myIcon has not been set explicitly. */
+  const QIcon& ownIcon() const;
+
   /*! \brief Iterates all descendants. *this is not iterated. */
   void forEachDescendant(const std::function<void(SUIT_ShortcutItemAssets&)>& theFunc) const;
 
@@ -280,10 +287,13 @@ public:
   std::map<QString, LangDependentAssets> myLangDependentAssets;
   QString myIconPath;
 
-  /*! Not serialized. */
-  QIcon myIcon;
+  /*! Not serialized. Decoded lazily, use \ref ownIcon() to get it. */
+  mutable QIcon myIcon;
 
 private:
+  /*! True, if myIconPath has been decoded into myIcon or decoding is not needed. */
+  mutable bool myIconIsLoaded;
+
   // { IDLastToken, assets }.
   std::map<QString, std::shared_ptr<SUIT_ShortcutItemAssets>> myChildren;
 };
@@ -627,8 +637,11 @@ public:
   if the module is root (theModuleID is empty) - returns all module IDs, otherwise returns ["", theModuleID]. */
   std::set<QString> getIDsOfInterferingModules(const QString& theModuleID) const;
 
+  /*! \brief Parses assets of the module from asset files on first request. */
   std::shared_ptr<const SUIT_ShortcutModuleAssets> getModuleAssets(const QString& theModuleID) const;
-  const std::map<QString, std::shared_ptr<SUIT_ShortcutModuleAssets>>& getModuleAssets() const { return myModuleAssets; }
+
+  /*! \brief Parses assets of all modules, which have not been requested yet. */
+  const std::map<QString, std::shared_ptr<SUIT_ShortcutModuleAssets>>& getModuleAssets() const;
 
   /*! \brief Retrieves module name, if the asset was loaded using \ref setAssetsFromResources(). If theLang is empty, it is current language. */
   QString getModuleName(const QString& theModuleID, const QString& theLang = "") const;
@@ -757,9 +770,19 @@ private:
   The JSON above describes an action-folder with ID "moduleID/actionA_IDLastToken" and a pure folder with ID "moduleID/folderC_IDLastToken".
   The action-folder has a nested action with "moduleID/actionA_IDLastToken//actionB_IDLastToken".
   Requirements for action' and folder' IDs are the same.
+
+  Asset files are only indexed here: the method records, where assets of each module are located in each file.
+  Assets of a module are parsed by \ref loadModuleAssets() on first request. Icons are decoded on first display.
   */
   void setAssetsFromResources(QString theLanguage = QString());
 
+  /*! \brief Parses assets of the module from locations, indexed by \ref setAssetsFromResources().
+  Does nothing, if the module is not indexed or its assets have already been parsed. */
+  void loadModuleAssets(const QString& theModuleID) const;
+
+  /*! \brief Fills assets of module itself (not its actions/folders), which are absent in asset files, using module resources. */
+  static void setDefaultModuleAssets(SUIT_ShortcutModuleAssets& theModuleAssets);
+
   void registerAnonymousShortcut(QAction* const theAction);
   void enableAnonymousShortcutsClashingWith(const QString& theModuleID, const bool theEnable) const;
   void enableAnonymousShortcutsClashingWith(const QKeySequence& theKeySequence, bool theEnable) const;
@@ -788,6 +811,20 @@ private:
   /** True, if SUIT_ShortcutMgr::setAssetsFromResources(QString) was called. */
   bool myAssetsLoaded;
 
+  /** Location of assets of a module within an asset file. */
+  struct AssetLocation
+  {
+    QString myFilePath;
+    qint64 myOffset;
+    qint64 mySize;
+  };
+
+  /** {moduleID, locations[]}[]. Modules, whose assets are indexed, but not parsed yet. Locations are sorted in order of asset files. */
+  mutable std::map<QString, std::vector<AssetLocation>> myAssetIndex;
+
+  /** Languages of assets to parse. */
+  std::set<QString> myAssetLangs;
+
   mutable std::set<QString> myActiveModuleIDs;
 
   /** Actions without IDs, but with hard-coded non-empty key sequences.
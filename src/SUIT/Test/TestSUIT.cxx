@@ -0,0 +1,166 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "SUIT_DataObject.h"
+#include "SUIT_PreferenceMgr.h"
+#include "SUIT_ResourceMgr.h"
+
+#include <QApplication>
+
+/*!
+  \class SUITTest: test suit
+*/
+class SUITTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( SUITTest );
+  CPPUNIT_TEST( testDataObjectChildren );
+  CPPUNIT_TEST( testPreferences );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void testDataObjectChildren();
+  void testPreferences();
+};
+
+/*!
+  Check positions of children and measure time of building and browsing
+  of the data object with one million children
+*/
+void SUITTest::testDataObjectChildren()
+{
+  const int aNbChildren = 1000000;
+
+  GuiTest_Timer aTimer( QString( "SUIT_DataObject with %1 children" ).arg( aNbChildren ) );
+
+  SUIT_DataObject* aRoot = new SUIT_DataObject( 0 );
+  for ( int i = 0; i < aNbChildren; i++ )
+    new SUIT_DataObject( aRoot );
+  aTimer.step( "build" );
+  CPPUNIT_ASSERT_EQUAL( aNbChildren, aRoot->childCount() );
+
+  // browse children as the tree model does: sibling navigation and positions
+  int aNbBrowsed = 0;
+  for ( SUIT_DataObject* aChild = aRoot->firstChild(); aChild; aChild = aChild->nextBrother() ) {
+    CPPUNIT_ASSERT_EQUAL( aNbBrowsed, aChild->position() );
+    aNbBrowsed++;
+  }
+  aTimer.step( "browse" );
+  CPPUNIT_ASSERT_EQUAL( aNbChildren, aNbBrowsed );
+
+  // insertion and removal in the middle shift positions of the tail
+  SUIT_DataObject* aFirst = aRoot->firstChild();
+  SUIT_DataObject* aLast = aRoot->lastChild();
+  SUIT_DataObject* anInserted = new SUIT_DataObject( 0 );
+  aRoot->insertChild( anInserted, aNbChildren / 2 );
+  CPPUNIT_ASSERT_EQUAL( aNbChildren / 2, anInserted->position() );
+  CPPUNIT_ASSERT_EQUAL( aNbChildren, aLast->position() );
+  CPPUNIT_ASSERT_EQUAL( 0, aFirst->position() );
+
+  SUIT_DataObject* aPrev = anInserted->prevBrother();
+  SUIT_DataObject* aNext = anInserted->nextBrother();
+  aRoot->removeChild( anInserted );
+  CPPUNIT_ASSERT_EQUAL( -1, anInserted->position() );
+  CPPUNIT_ASSERT( aPrev->nextBrother() == aNext );
+  CPPUNIT_ASSERT_EQUAL( aNbChildren - 1, aLast->position() );
+  delete anInserted;
+
+  // moving child to another parent detaches it from the previous one
+  SUIT_DataObject* anOther = new SUIT_DataObject( 0 );
+  anOther->appendChild( aFirst );
+  CPPUNIT_ASSERT( aFirst->parent() == anOther );
+  CPPUNIT_ASSERT_EQUAL( aNbChildren - 1, aRoot->childCount() );
+  CPPUNIT_ASSERT_EQUAL( aNbChildren / 2 - 1, aRoot->childPos( aNext ) );
+  delete anOther;
+  aTimer.step( "insert/remove" );
+
+  delete aRoot;
+  aTimer.step( "delete" );
+  aTimer.print();
+}
+
+/*!
+  Check items of preference pages created on demand and measure time of creation
+  and first showing of preferences with five thousand items, with and without
+  deferred creation of the pages contents
+*/
+void SUITTest::testPreferences()
+{
+  const int aNbModules = 20, aNbTabs = 5, aNbGroups = 10, aNbValues = 5;
+  const int aNbItems = aNbModules * aNbTabs * aNbGroups * aNbValues;
+
+  SUIT_ResourceMgr aResMgr( "TestSUIT" );
+  GuiTest_Timer aTimer( QString( "SUIT_PreferenceMgr with %1 items" ).arg( aNbItems ) );
+
+  for ( int aMode = 0; aMode < 2; aMode++ ) {
+    const bool isDeferred = aMode == 1;
+    const QString aPrefix = isDeferred ? "deferred " : "";
+    aTimer.restart();
+
+    SUIT_PreferenceMgr* aPrefs = new SUIT_PreferenceMgr( &aResMgr );
+    aPrefs->setDeferred( isDeferred );
+    int aFirstValue = -1, aLastValue = -1;
+    for ( int m = 0; m < aNbModules; m++ ) {
+      int aModule = aPrefs->addItem( QString( "Module %1" ).arg( m ) );
+      for ( int t = 0; t < aNbTabs; t++ ) {
+        int aTab = aPrefs->addItem( QString( "Tab %1" ).arg( t ), aModule );
+        for ( int g = 0; g < aNbGroups; g++ ) {
+          int aGroup = aPrefs->addItem( QString( "Group %1" ).arg( g ), aTab );
+          aPrefs->setItemProperty( "columns", 2, aGroup );
+          for ( int v = 0; v < aNbValues; v++ ) {
+            QString aName = QString( "value_%1_%2_%3_%4" ).arg( m ).arg( t ).arg( g ).arg( v );
+            aLastValue = aPrefs->addItem( aName, aGroup, SUIT_PreferenceMgr::IntSpin, "TestSUIT", aName );
+            aPrefs->setItemProperty( "max", 1000, aLastValue );
+            if ( aFirstValue < 0 )
+              aFirstValue = aLastValue;
+          }
+        }
+      }
+    }
+    aPrefs->retrieve();
+    aTimer.step( aPrefix + "create" );
+
+    // first page is shown
+    aPrefs->show();
+    QApplication::processEvents();
+    aTimer.step( aPrefix + "show" );
+
+    // items are accessed by the same identifiers, options are kept
+    CPPUNIT_ASSERT( dynamic_cast<QtxPagePrefSpinItem*>( aPrefs->findItem( aFirstValue, true ) ) );
+    CPPUNIT_ASSERT_EQUAL( 1000, aPrefs->itemProperty( "max", aFirstValue ).toInt() );
+    CPPUNIT_ASSERT_EQUAL( 1000, aPrefs->itemProperty( "max", aLastValue ).toInt() );
+
+    // items of the pages not shown are not created in deferred mode
+    CPPUNIT_ASSERT( aPrefs->findItem( aLastValue, true ) );
+    CPPUNIT_ASSERT_EQUAL( !isDeferred,
+                          dynamic_cast<QtxPagePrefSpinItem*>( aPrefs->findItem( aLastValue, true ) ) != 0 );
+
+    delete aPrefs;
+  }
+  aTimer.print();
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SUITTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"
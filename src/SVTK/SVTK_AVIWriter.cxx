@@ -0,0 +1,293 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "SVTK_AVIWriter.h"
+
+#include <QDataStream>
+
+#include <math.h>
+
+namespace
+{
+  // size of RIFF, hdrl LIST and movi LIST headers preceding the frames
+  const qint64 HEADERS_SIZE = 224;
+  // position of 'movi' identifier, the index offsets are relative to it
+  const qint64 MOVI_POSITION = 220;
+  // size of the file must fit into 32-bit RIFF size
+  const qint64 MAX_FILE_SIZE = Q_INT64_C(0xFFFFFFFF);
+
+  //----------------------------------------------------------------------------
+  inline
+  void
+  WriteFourCC(QDataStream& theStream,
+              const char* theFourCC)
+  {
+    theStream.writeRawData(theFourCC, 4);
+  }
+
+  //----------------------------------------------------------------------------
+  // Reads image size from the start of frame segment of JPEG data
+  bool
+  GetJPEGSize(const QByteArray& theJPEG,
+              int& theWidth,
+              int& theHeight)
+  {
+    const unsigned char* aData = (const unsigned char*)theJPEG.constData();
+    int aSize = theJPEG.size();
+    if(aSize < 4 || aData[0] != 0xFF || aData[1] != 0xD8)
+      return false;
+
+    int anId = 2;
+    while(anId + 8 < aSize){
+      if(aData[anId] != 0xFF)
+        return false;
+      unsigned char aMarker = aData[anId + 1];
+      if(aMarker >= 0xC0 && aMarker <= 0xCF &&
+         aMarker != 0xC4 && aMarker != 0xC8 && aMarker != 0xCC){
+        theHeight = (aData[anId + 5] << 8) | aData[anId + 6];
+        theWidth = (aData[anId + 7] << 8) | aData[anId + 8];
+        return true;
+      }
+      anId += 2 + ((aData[anId + 2] << 8) | aData[anId + 3]);
+    }
+    return false;
+  }
+}
+
+//----------------------------------------------------------------------------
+const qint64 SVTK_AVIWriter::DefaultMaxFileSize;
+
+//----------------------------------------------------------------------------
+SVTK_AVIWriter
+::SVTK_AVIWriter():
+  myFPS(0.0),
+  myWidth(0),
+  myHeight(0),
+  myMaxFrameSize(0),
+  myMaxFileSize(DefaultMaxFileSize),
+  myIsFull(false)
+{}
+
+//----------------------------------------------------------------------------
+SVTK_AVIWriter
+::~SVTK_AVIWriter()
+{
+  Close();
+}
+
+
+//----------------------------------------------------------------------------
+void
+SVTK_AVIWriter
+::SetMaxFileSize(qint64 theSize)
+{
+  myMaxFileSize = qBound(HEADERS_SIZE, theSize, MAX_FILE_SIZE);
+}
+
+qint64
+SVTK_AVIWriter
+::MaxFileSize() const
+{
+  return myMaxFileSize;
+}
+
+bool
+SVTK_AVIWriter
+::IsFull() const
+{
+  return myIsFull;
+}
+
+
+//----------------------------------------------------------------------------
+bool
+SVTK_AVIWriter
+::Open(const QString& theFileName,
+       double theFPS)
+{
+  Close();
+
+  myFile.setFileName(theFileName);
+  if(!myFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    return false;
+
+  myFPS = theFPS > 0.0 ? theFPS : 1.0;
+  myWidth = myHeight = 0;
+  myMaxFrameSize = 0;
+  myIsFull = false;
+  myOffsets.clear();
+  mySizes.clear();
+
+  // headers are rewritten with the actual values by Close()
+  WriteHeaders();
+  return myFile.error() == QFile::NoError;
+}
+
+
+//----------------------------------------------------------------------------
+bool
+SVTK_AVIWriter
+::AddFrame(const QByteArray& theJPEG)
+{
+  if(!myFile.isOpen() || theJPEG.isEmpty())
+    return false;
+
+  if(myOffsets.isEmpty() && !GetJPEGSize(theJPEG, myWidth, myHeight))
+    return false;
+
+  // the frame chunk and the index of all frames must fit into the file
+  quint32 aSize = theJPEG.size();
+  qint64 aChunkSize = 8 + aSize + aSize % 2;
+  qint64 anIndexSize = 8 + 16 * qint64(myOffsets.size() + 1);
+  if(myIsFull || myFile.pos() + aChunkSize + anIndexSize > myMaxFileSize){
+    myIsFull = true;
+    return false;
+  }
+
+  myOffsets.append(quint32(myFile.pos() - MOVI_POSITION));
+  mySizes.append(aSize);
+  myMaxFrameSize = qMax(myMaxFrameSize, aSize);
+
+  QDataStream aStream(&myFile);
+  aStream.setByteOrder(QDataStream::LittleEndian);
+  WriteFourCC(aStream, "00dc");
+  aStream << aSize;
+  aStream.writeRawData(theJPEG.constData(), aSize);
+  if(aSize % 2)
+    aStream << quint8(0);
+
+  return aStream.status() == QDataStream::Ok;
+}
+
+
+//----------------------------------------------------------------------------
+bool
+SVTK_AVIWriter
+::Close()
+{
+  if(!myFile.isOpen())
+    return true;
+
+  QDataStream aStream(&myFile);
+  aStream.setByteOrder(QDataStream::LittleEndian);
+
+  // index of the frames, all of them are key frames
+  WriteFourCC(aStream, "idx1");
+  aStream << quint32(16 * myOffsets.size());
+  for(int anId = 0; anId < myOffsets.size(); anId++){
+    WriteFourCC(aStream, "00dc");
+    aStream << quint32(0x10) << myOffsets[anId] << mySizes[anId];
+  }
+
+  WriteHeaders();
+  bool aResult = aStream.status() == QDataStream::Ok && myFile.error() == QFile::NoError;
+  myFile.close();
+  return aResult;
+}
+
+
+//----------------------------------------------------------------------------
+int
+SVTK_AVIWriter
+::NbFrames() const
+{
+  return myOffsets.size();
+}
+
+
+//----------------------------------------------------------------------------
+void
+SVTK_AVIWriter
+::WriteHeaders()
+{
+  qint64 anEnd = qMax(myFile.pos(), HEADERS_SIZE);
+  qint64 aMoviSize = 4;
+  for(int anId = 0; anId < mySizes.size(); anId++)
+    aMoviSize += 8 + mySizes[anId] + mySizes[anId] % 2;
+
+  quint32 aNbFrames = myOffsets.size();
+  quint32 aMicroSecPerFrame = quint32(1000000.0 / myFPS + 0.5);
+  quint32 aRate = quint32(myFPS * 1000.0 + 0.5);
+
+  myFile.seek(0);
+  QDataStream aStream(&myFile);
+  aStream.setByteOrder(QDataStream::LittleEndian);
+
+  WriteFourCC(aStream, "RIFF");
+  aStream << quint32(qMax(anEnd, myFile.size()) - 8);
+  WriteFourCC(aStream, "AVI ");
+
+  WriteFourCC(aStream, "LIST");
+  aStream << quint32(192);
+  WriteFourCC(aStream, "hdrl");
+
+  // main AVI header
+  WriteFourCC(aStream, "avih");
+  aStream << quint32(56)
+          << aMicroSecPerFrame
+          << quint32(ceil(myMaxFrameSize * myFPS))
+          << quint32(0)                // padding granularity
+          << quint32(0x10)             // AVIF_HASINDEX
+          << aNbFrames
+          << quint32(0)                // initial frames
+          << quint32(1)                // streams
+          << myMaxFrameSize
+          << quint32(myWidth)
+          << quint32(myHeight)
+          << quint32(0) << quint32(0) << quint32(0) << quint32(0);
+
+  WriteFourCC(aStream, "LIST");
+  aStream << quint32(116);
+  WriteFourCC(aStream, "strl");
+
+  // video stream header
+  WriteFourCC(aStream, "strh");
+  aStream << quint32(56);
+  WriteFourCC(aStream, "vids");
+  WriteFourCC(aStream, "MJPG");
+  aStream << quint32(0)                // flags
+          << quint16(0) << quint16(0)  // priority, language
+          << quint32(0)                // initial frames
+          << quint32(1000)             // scale
+          << aRate
+          << quint32(0)                // start
+          << aNbFrames
+          << myMaxFrameSize
+          << quint32(0xFFFFFFFF)       // default quality
+          << quint32(0)                // sample size
+          << qint16(0) << qint16(0) << qint16(myWidth) << qint16(myHeight);
+
+  // video stream format
+  WriteFourCC(aStream, "strf");
+  aStream << quint32(40)
+          << quint32(40)
+          << qint32(myWidth)
+          << qint32(myHeight)
+          << quint16(1)                // planes
+          << quint16(24);              // bit count
+  WriteFourCC(aStream, "MJPG");
+  aStream << quint32(myWidth * myHeight * 3)
+          << qint32(0) << qint32(0) << quint32(0) << quint32(0);
+
+  WriteFourCC(aStream, "LIST");
+  aStream << quint32(aMoviSize);
+  WriteFourCC(aStream, "movi");
+
+  myFile.seek(anEnd);
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef SVTK_AVIWRITER_H
+#define SVTK_AVIWRITER_H
+
+#include "SVTK.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QVector>
+
+// Writes a sequence of JPEG images to a Motion JPEG AVI file
+// (AVI 1.0 container, its sizes and offsets are 32-bit; frames which
+// would make the file exceed the maximum size are not written)
+class SVTK_EXPORT SVTK_AVIWriter
+{
+ public:
+  SVTK_AVIWriter();
+  ~SVTK_AVIWriter();
+
+  // Default maximum size, files bigger than 1GB are not played by some AVI 1.0 players
+  static const qint64 DefaultMaxFileSize = Q_INT64_C(1) << 30;
+
+  // Sets maximum size of the file, it is bounded by 4GB
+  void
+  SetMaxFileSize(qint64 theSize);
+
+  qint64
+  MaxFileSize() const;
+
+  // Returns true if a frame has been rejected because of the maximum size
+  bool
+  IsFull() const;
+
+  bool
+  Open(const QString& theFileName,
+       double theFPS);
+
+  bool
+  AddFrame(const QByteArray& theJPEG);
+
+  bool
+  Close();
+
+  int
+  NbFrames() const;
+
+ protected:
+  void
+  WriteHeaders();
+
+  QFile myFile;
+  double myFPS;
+  int myWidth;
+  int myHeight;
+  quint32 myMaxFrameSize;
+  qint64 myMaxFileSize;
+  bool myIsFull;
+  QVector<quint32> myOffsets;
+  QVector<quint32> mySizes;
+};
+
+#endif
@@ -18,12 +18,10 @@
 //
 
 #include "SVTK_ImageWriter.h"
+#include "SVTK_ImageWriterMgr.h"
 
 #include "utilities.h"
 
-#include <QSemaphore>
-
-#include <vtkAlgorithm.h>
 #include <vtkImageData.h>
 #include <vtkImageClip.h>
 #include <vtkJPEGWriter.h>
@@ -33,18 +31,8 @@
 
 //----------------------------------------------------------------------------
 SVTK_ImageWriter
-::SVTK_ImageWriter(QSemaphore* theSemaphore,
-                   vtkAlgorithm* theAlgorithm,
-                   vtkImageData* theImageData,
-                   const std::string& theName,
-                   int theProgressive,
-                   int theQuality):
-  mySemaphore(theSemaphore),
-  myAlgorithm(theAlgorithm),
-  myImageData(theImageData),
-  myName(theName),
-  myProgressive(theProgressive),
-  myQuality(theQuality),
+::SVTK_ImageWriter(SVTK_ImageWriterMgr* theManager):
+  myManager(theManager),
   myConstraint16Flag(true)
 {}
 
@@ -62,48 +50,46 @@ void
 SVTK_ImageWriter
 ::run()
 {
-  vtkJPEGWriter *aWriter = vtkJPEGWriter::New();
-  vtkAlgorithmOutput *anImageData = 0;
-  vtkSmartPointer<vtkImageClip> anImageClip;
-  //
-  if(myConstraint16Flag){ 
-    int uExtent[6];
-    myAlgorithm->UpdateInformation();
-    myAlgorithm->GetUpdateExtent(uExtent);
-    unsigned int width = uExtent[1] - uExtent[0] + 1;
-    unsigned int height = uExtent[3] - uExtent[2] + 1;
-    width = (width / 16) * 16;
-    height= (height / 16) * 16;
-    uExtent[1] = uExtent[0] + width - 1;
-    uExtent[3] = uExtent[2] + height - 1;
-    //
-    anImageClip = vtkImageClip::New();
-    anImageClip->Delete();
-
-    anImageClip->SetInputData(myImageData);
-    anImageClip->SetOutputWholeExtent(uExtent);
-    anImageClip->ClipDataOn();
-    anImageData = anImageClip->GetOutputPort();
-  }
-  //
+  // writer and clip filter are reused for all frames written by this thread
+  vtkSmartPointer<vtkJPEGWriter> aWriter = vtkSmartPointer<vtkJPEGWriter>::New();
+  vtkSmartPointer<vtkImageClip> anImageClip = vtkSmartPointer<vtkImageClip>::New();
   aWriter->WriteToMemoryOff();
-  aWriter->SetFileName(myName.c_str());
-  aWriter->SetQuality(myQuality);
-  aWriter->SetProgressive(myProgressive);
-  if(myConstraint16Flag)
-    aWriter->SetInputConnection(anImageData);
-  else
-    aWriter->SetInputData(myImageData);
-  aWriter->Write();
+  anImageClip->ClipDataOn();
 
-  aWriter->Delete();
-  myImageData->Delete();
+  SVTK_ImageWriterMgr::TTask aTask;
+  while(myManager->TakeTask(aTask)){
+    vtkImageData* anImageData = aTask.myImageData;
+    if(myConstraint16Flag){ 
+      int uExtent[6];
+      anImageData->GetExtent(uExtent);
+      unsigned int width = uExtent[1] - uExtent[0] + 1;
+      unsigned int height = uExtent[3] - uExtent[2] + 1;
+      width = (width / 16) * 16;
+      height= (height / 16) * 16;
+      uExtent[1] = uExtent[0] + width - 1;
+      uExtent[3] = uExtent[2] + height - 1;
+      //
+      anImageClip->SetInputData(anImageData);
+      anImageClip->SetOutputWholeExtent(uExtent);
+      aWriter->SetInputConnection(anImageClip->GetOutputPort());
+    }
+    else
+      aWriter->SetInputData(anImageData);
 
-  if(SALOME::VerbosityActivated())
-    std::cout << "SVTK_ImageWriter::run - this = " << this <<
-    //"; total = "<<mySemaphore->total()<<
-    "; available = " << mySemaphore->available() << endl;
-    
-  mySemaphore->release();
-}
+    aWriter->SetFileName(aTask.myName.c_str());
+    aWriter->SetQuality(aTask.myQuality);
+    aWriter->SetProgressive(aTask.myProgressive);
+    aWriter->Write();
 
+    // the buffer goes back to the pool, so the pipeline must not keep it
+    anImageClip->SetInputData(NULL);
+    if(!myConstraint16Flag)
+      aWriter->SetInputData(NULL);
+
+    if(SALOME::VerbosityActivated())
+      std::cout << "SVTK_ImageWriter::run - this = " << this <<
+      "; name = " << aTask.myName << endl;
+
+    myManager->FinishTask(aTask);
+  }
+}
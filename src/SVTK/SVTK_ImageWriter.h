@@ -21,21 +21,15 @@
 #define SVTK_IMAGEWRITER_H
 
 #include <QThread>
-#include <string>
 
-class vtkAlgorithm;
-class vtkImageData;
-class QSemaphore;
+class SVTK_ImageWriterMgr;
 
+// Worker thread of SVTK_ImageWriterMgr pool: writes queued frames
+// to JPEG files until the manager is destroyed
 class SVTK_ImageWriter : public QThread 
 {
 public:
-  SVTK_ImageWriter(QSemaphore* theSemaphore,
-                   vtkAlgorithm* theAlgorithm,
-                   vtkImageData* theImageData,
-                   const std::string& theName,
-                   int theProgressive,
-                   int theQuality);
+  SVTK_ImageWriter(SVTK_ImageWriterMgr* theManager);
 
   ~SVTK_ImageWriter();
 
@@ -45,12 +39,7 @@ public:
   run();
   
  protected:
-  QSemaphore* mySemaphore;
-  vtkAlgorithm *myAlgorithm;
-  vtkImageData *myImageData;
-  std::string myName;
-  int   myProgressive;
-  int   myQuality;
+  SVTK_ImageWriterMgr* myManager;
   bool  myConstraint16Flag;
 };
 
@@ -22,23 +22,68 @@
 
 #include "utilities.h"
 
-#include <vtkAlgorithm.h>
+#include <vtkDataArray.h>
 #include <vtkImageData.h>
+#include <vtkPointData.h>
 
-#include <QSemaphore>
+#include <QMutexLocker>
+#include <QThread>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
-#include <limits>
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Copies the scalars of the image to the buffer, the buffer memory is
+  // reallocated only if the size or the type of the image has been changed
+  bool
+  CopyImage(vtkImageData* theSource,
+            vtkImageData* theBuffer)
+  {
+    vtkDataArray* aScalars = theSource->GetPointData()->GetScalars();
+    if(!aScalars)
+      return false;
+
+    int aType = aScalars->GetDataType();
+    int aNbComponents = aScalars->GetNumberOfComponents();
+    int anExtent[6], aBufferExtent[6];
+    theSource->GetExtent(anExtent);
+    theBuffer->GetExtent(aBufferExtent);
+
+    vtkDataArray* aBufferScalars = theBuffer->GetPointData()->GetScalars();
+    if(!aBufferScalars ||
+       aBufferScalars->GetDataType() != aType ||
+       aBufferScalars->GetNumberOfComponents() != aNbComponents ||
+       !std::equal(anExtent, anExtent + 6, aBufferExtent)){
+      theBuffer->SetExtent(anExtent);
+      theBuffer->SetOrigin(theSource->GetOrigin());
+      theBuffer->SetSpacing(theSource->GetSpacing());
+      theBuffer->AllocateScalars(aType, aNbComponents);
+      aBufferScalars = theBuffer->GetPointData()->GetScalars();
+    }
+
+    size_t aSize = size_t(aScalars->GetNumberOfTuples()) * aNbComponents * aScalars->GetDataTypeSize();
+    memcpy(aBufferScalars->GetVoidPointer(0), aScalars->GetVoidPointer(0), aSize);
+    theBuffer->Modified();
+    return true;
+  }
+}
 
 //----------------------------------------------------------------------------
 SVTK_ImageWriterMgr
-::SVTK_ImageWriterMgr()
+::SVTK_ImageWriterMgr():
+  myMaxQueueSize(0),
+  myDropFrames(false),
+  myNbDroppedFrames(0),
+  myNbActiveTasks(0),
+  myIsDestroying(false)
 {
-  int aMax = std::numeric_limits<int>::max() / 2;
-  mySemaphore = new QSemaphore(aMax);
-  mySemaphore->acquire( aMax );
-  if(SALOME::VerbosityActivated())
-    std::cout << "SVTK_ImageWriterMgr::SVTK_ImageWriterMgr; available = " << mySemaphore->available() << endl;
+  // the main thread renders the frames, other cores encode them
+  int aNbThreads = std::max(1, std::min(QThread::idealThreadCount() - 1, 8));
+  myMaxQueueSize = 2 * aNbThreads;
+  myThreads.resize(aNbThreads, 0);
 }
 
 
@@ -47,30 +92,122 @@ SVTK_ImageWriterMgr
 ::~SVTK_ImageWriterMgr()
 {
   Stop();
-  delete mySemaphore;
+
+  {
+    QMutexLocker aLocker(&myMutex);
+    myIsDestroying = true;
+    myTaskAdded.wakeAll();
+  }
+  for(size_t anId = 0, anEnd = myThreads.size(); anId < anEnd; anId++){
+    if(SVTK_ImageWriter* anImageWriter = myThreads[anId]){
+      anImageWriter->wait();
+      delete anImageWriter;
+    }
+  }
+  myThreads.clear();
+
+  for(size_t anId = 0, anEnd = myFreeBuffers.size(); anId < anEnd; anId++)
+    myFreeBuffers[anId]->Delete();
+  myFreeBuffers.clear();
 }
 
 
 //----------------------------------------------------------------------------
 void
 SVTK_ImageWriterMgr
-::StartImageWriter(vtkAlgorithm *theAlgorithm,
-                   vtkImageData *theImageData,
+::StartThreads()
+{
+  // threads are started with the first frame and live until the manager is destroyed
+  for(size_t anId = 0, anEnd = myThreads.size(); anId < anEnd; anId++){
+    if(!myThreads[anId]){
+      myThreads[anId] = new SVTK_ImageWriter(this);
+      myThreads[anId]->start();
+    }
+  }
+}
+
+
+//----------------------------------------------------------------------------
+bool
+SVTK_ImageWriterMgr
+::StartImageWriter(vtkImageData *theImageData,
                    const std::string& theName,
                    const int theProgressive,
                    const int theQuality)
 {
-  SVTK_ImageWriter *anImageWriter = 
-    new SVTK_ImageWriter(mySemaphore,
-                         theAlgorithm,
-                         theImageData,
-                         theName,
-                         theProgressive,
-                         theQuality);
-  myThreads.push_back(anImageWriter);
+  if(!theImageData)
+    return false;
+
+  StartThreads();
+
+  vtkImageData* aBuffer = 0;
+  {
+    QMutexLocker aLocker(&myMutex);
+    if((int)myTasks.size() >= myMaxQueueSize){
+      if(myDropFrames){
+        myNbDroppedFrames++;
+        if(SALOME::VerbosityActivated())
+          std::cout << "SVTK_ImageWriterMgr::StartImageWriter - frame dropped: " << theName << endl;
+        return false;
+      }
+      while((int)myTasks.size() >= myMaxQueueSize)
+        myTaskFinished.wait(&myMutex);
+    }
+    if(!myFreeBuffers.empty()){
+      aBuffer = myFreeBuffers.back();
+      myFreeBuffers.pop_back();
+    }
+  }
+
+  // the frame is copied outside of the lock, so the workers are not blocked
+  if(!aBuffer)
+    aBuffer = vtkImageData::New();
+  if(!CopyImage(theImageData, aBuffer)){
+    QMutexLocker aLocker(&myMutex);
+    myFreeBuffers.push_back(aBuffer);
+    return false;
+  }
 
-  anImageWriter->start();
+  TTask aTask;
+  aTask.myImageData = aBuffer;
+  aTask.myName = theName;
+  aTask.myProgressive = theProgressive;
+  aTask.myQuality = theQuality;
 
+  QMutexLocker aLocker(&myMutex);
+  myTasks.push_back(aTask);
+  myTaskAdded.wakeOne();
+  return true;
+}
+
+
+//----------------------------------------------------------------------------
+bool
+SVTK_ImageWriterMgr
+::TakeTask(TTask& theTask)
+{
+  QMutexLocker aLocker(&myMutex);
+  while(myTasks.empty() && !myIsDestroying)
+    myTaskAdded.wait(&myMutex);
+  if(myTasks.empty())
+    return false;
+
+  theTask = myTasks.front();
+  myTasks.pop_front();
+  myNbActiveTasks++;
+  return true;
+}
+
+
+//----------------------------------------------------------------------------
+void
+SVTK_ImageWriterMgr
+::FinishTask(const TTask& theTask)
+{
+  QMutexLocker aLocker(&myMutex);
+  myFreeBuffers.push_back(theTask.myImageData);
+  myNbActiveTasks--;
+  myTaskFinished.wakeAll();
 }
 
 
@@ -79,20 +216,65 @@ void
 SVTK_ImageWriterMgr
 ::Stop()
 {
-  if(SALOME::VerbosityActivated())
-    std::cout << "SVTK_ImageWriterMgr::Stop " <<
-    //"- total = "<<mySemaphore->total()<<
-    "; available = " << mySemaphore->available() << endl;
+  QMutexLocker aLocker(&myMutex);
 
   if(SALOME::VerbosityActivated())
-    std::cout << "SVTK_ImageWriterMgr::Stop - *mySemaphore += " << myThreads.size() << endl;
-    
-  mySemaphore->acquire( (int)myThreads.size() ); //!< TODO: conversion from size_t to int
+    std::cout << "SVTK_ImageWriterMgr::Stop - queued = " << myTasks.size() <<
+    "; active = " << myNbActiveTasks << "; dropped = " << myNbDroppedFrames << endl;
 
-  for(size_t anId = 0, anEnd = myThreads.size(); anId < anEnd; anId++){
-    SVTK_ImageWriter* anImageWriter = myThreads[anId];
-    anImageWriter->wait();
-    delete anImageWriter;
-  }
-  myThreads.clear();
+  // wait for all the queued frames to be written
+  while(!myTasks.empty() || myNbActiveTasks > 0)
+    myTaskFinished.wait(&myMutex);
+}
+
+
+//----------------------------------------------------------------------------
+void
+SVTK_ImageWriterMgr
+::SetMaxQueueSize(int theSize)
+{
+  QMutexLocker aLocker(&myMutex);
+  myMaxQueueSize = std::max(1, theSize);
+}
+
+int
+SVTK_ImageWriterMgr
+::MaxQueueSize() const
+{
+  QMutexLocker aLocker(&myMutex);
+  return myMaxQueueSize;
+}
+
+
+//----------------------------------------------------------------------------
+void
+SVTK_ImageWriterMgr
+::SetDropFrames(bool theDropFrames)
+{
+  QMutexLocker aLocker(&myMutex);
+  myDropFrames = theDropFrames;
+}
+
+bool
+SVTK_ImageWriterMgr
+::DropFrames() const
+{
+  QMutexLocker aLocker(&myMutex);
+  return myDropFrames;
+}
+
+int
+SVTK_ImageWriterMgr
+::NbDroppedFrames() const
+{
+  QMutexLocker aLocker(&myMutex);
+  return myNbDroppedFrames;
+}
+
+int
+SVTK_ImageWriterMgr
+::NbQueuedFrames() const
+{
+  QMutexLocker aLocker(&myMutex);
+  return (int)myTasks.size();
 }
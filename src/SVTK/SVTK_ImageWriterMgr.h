@@ -20,24 +20,37 @@
 #ifndef SVTK_IMAGEWRITERMGR_H
 #define SVTK_IMAGEWRITERMGR_H
 
+#include "SVTK.h"
+
+#include <QMutex>
+#include <QWaitCondition>
+
+#include <deque>
 #include <string>
 #include <vector>
 
-class QString;
-class vtkAlgorithm;
 class vtkImageData;
 class SVTK_ImageWriter;
-class QSemaphore;
 
-class SVTK_ImageWriterMgr
+// Writes frames to JPEG files with a fixed pool of worker threads.
+// Frames are copied to pooled buffers and queued; when the queue is full,
+// the caller either waits for a free place or the frame is dropped.
+class SVTK_EXPORT SVTK_ImageWriterMgr
 {
  public:
+  struct TTask
+  {
+    vtkImageData* myImageData;
+    std::string myName;
+    int myProgressive;
+    int myQuality;
+  };
+
   SVTK_ImageWriterMgr();
   ~SVTK_ImageWriterMgr();
   
-  void
-  StartImageWriter(vtkAlgorithm *theAlgorithm,
-                   vtkImageData *theImageData,
+  bool
+  StartImageWriter(vtkImageData *theImageData,
                    const std::string& theName,
                    const int theProgressive,
                    const int theQuality);
@@ -45,13 +58,52 @@ class SVTK_ImageWriterMgr
   void
   Stop();
 
+  void
+  SetMaxQueueSize(int theSize);
+
+  int
+  MaxQueueSize() const;
+
+  void
+  SetDropFrames(bool theDropFrames);
+
+  bool
+  DropFrames() const;
+
+  int
+  NbDroppedFrames() const;
+
+  int
+  NbQueuedFrames() const;
+
+  // called by the worker threads
+  bool
+  TakeTask(TTask& theTask);
+
+  void
+  FinishTask(const TTask& theTask);
+
   typedef std::vector<SVTK_ImageWriter*> TWriterThreads;
+  typedef std::vector<vtkImageData*> TBuffers;
+  typedef std::deque<TTask> TTasks;
 
  protected:
+  void
+  StartThreads();
+
   TWriterThreads myThreads;
+  TBuffers myFreeBuffers;
+  TTasks myTasks;
 
-  QSemaphore* mySemaphore;
+  int myMaxQueueSize;
+  bool myDropFrames;
+  int myNbDroppedFrames;
+  int myNbActiveTasks;
+  bool myIsDestroying;
+
+  mutable QMutex myMutex;
+  QWaitCondition myTaskAdded;
+  QWaitCondition myTaskFinished;
 };
 
 #endif
-
@@ -19,7 +19,7 @@
 
 #include "SVTK_Recorder.h"
 
-#include "SVTK_ImageWriter.h"
+#include "SVTK_AVIWriter.h"
 #include "SVTK_ImageWriterMgr.h"
 
 #include <vtkObjectFactory.h>
@@ -31,6 +31,7 @@
 #include <vtkJPEGWriter.h>
 #include <vtkImageData.h>
 
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <iostream>
@@ -41,8 +42,7 @@
 #endif
 
 #include <QApplication>
-#include <QFileInfo>
-#include <QDir>
+#include <QFile>
 
 #include "utilities.h"
 
@@ -71,7 +71,7 @@ SVTK_Recorder
 ::SVTK_Recorder():
   myState(SVTK_Recorder_Stop),
   myPaused(0),
-  myErrorStatus(0),
+  myErrorStatus(SVTK_Recorder_NoError),
   myPriority(0.0),
   myTimeStart(0.0),
   myFrameIndex(0),
@@ -80,7 +80,6 @@ SVTK_Recorder
   myQuality(100),
   myProgressiveMode(true),
   myUseSkippedFrames(true),
-  myNameAVIMaker("jpeg2yuv"),
   myCommand(vtkCallbackCommand::New()),
   myRenderWindow(NULL),
   myFilter(vtkWindowToImageFilter::New()),
@@ -106,17 +105,8 @@ void
 SVTK_Recorder
 ::CheckExistAVIMaker()
 {
-  myErrorStatus = 0;
-  std::ostringstream aStream;
-#ifndef WIN32
-  aStream<<"which "<<myNameAVIMaker<<" 2> /dev/null";
-#else
-  aStream<<"setlocal & set P2=.;%PATH% & (for %e in (%PATHEXT%) do @for %i in ("<<myNameAVIMaker<<"%e) do @if NOT \"%~$P2:i\"==\"\" exit /b 0) & exit /b 1";
-#endif
-  std::string anAVIMakeCheck = aStream.str();
-  int iErr = system(anAVIMakeCheck.c_str());
-  if(iErr != 0)
-    myErrorStatus = 127;
+  // AVI file is written by SVTK_AVIWriter, no external tool is needed
+  myErrorStatus = SVTK_Recorder_NoError;
 }
 
 
@@ -215,6 +205,25 @@ SVTK_Recorder
 }
 
 
+//----------------------------------------------------------------------------
+// If the writers can not keep up with recording, the new frames are
+// either dropped (and replaced by the previous ones in the movie) or
+// the recording waits for the writers
+void
+SVTK_Recorder
+::SetDropFrames(bool theDropFrames)
+{
+  myWriterMgr->SetDropFrames(theDropFrames);
+}
+
+bool
+SVTK_Recorder
+::DropFrames() const
+{
+  return myWriterMgr->DropFrames();
+}
+
+
 //----------------------------------------------------------------------------
 int
 SVTK_Recorder
@@ -285,12 +294,9 @@ SVTK_Recorder
 
     myWriterMgr->Stop();
 
-    if(myUseSkippedFrames)
-      AddSkippedFrames();
+    MakeFileAVI();
 
     myFrameIndexes.clear();
-
-    MakeFileAVI();
   }
   myState = SVTK_Recorder_Stop;
   myPaused = 0;
@@ -341,7 +347,7 @@ SVTK_Recorder
       return;
 
     // If there was a "pause" we correct the myTimeStart
-    int aLastFrameIndex = myFrameIndexes.back();
+    int aLastFrameIndex = myFrameIndexes.empty() ? 0 : myFrameIndexes.back();
     if(aLastFrameIndex < 0){
       myFrameIndexes.back() = abs(myFrameIndexes.back());
       double aPauseTime = fabs((double)(aFrameIndex - myFrameIndex - 1)) / myNbFPS;
@@ -360,7 +366,6 @@ SVTK_Recorder
     myFrameIndex = aFrameIndex;
   }
 
-  myFrameIndexes.push_back(myFrameIndex);
   if(SALOME::VerbosityActivated())
     std::cout << "SVTK_Recorder::DoRecord - myFrameIndex = " << myFrameIndex << endl;
 
@@ -372,11 +377,12 @@ SVTK_Recorder
 
   PreWrite();
 
-  vtkImageData *anImageData = vtkImageData::New();
-  anImageData->DeepCopy(myFilter->GetOutput());
-
-  myWriterMgr->StartImageWriter(myFilter,anImageData,aName,myProgressiveMode,myQuality);
-  myNbWrittenFrames++;
+  // frame is copied to a pooled buffer and written by the writers pool;
+  // dropped frame is filled by the previous one when the movie is made
+  if(myWriterMgr->StartImageWriter(myFilter->GetOutput(),aName,myProgressiveMode,myQuality)){
+    myFrameIndexes.push_back(myFrameIndex);
+    myNbWrittenFrames++;
+  }
 
   myRenderWindow->AddObserver(vtkCommand::EndEvent,
                               myCommand,
@@ -392,7 +398,7 @@ SVTK_Recorder
   vtkImageData *anImageData = myFilter->GetOutput();
   //
   if(!anImageData){
-    myErrorStatus = 20;
+    myErrorStatus = SVTK_Recorder_NoImage;
     return;
   }
   myFilter->UpdateInformation();
@@ -403,97 +409,50 @@ SVTK_Recorder
 //----------------------------------------------------------------------------
 void
 SVTK_Recorder
-::AddSkippedFrames()
+::MakeFileAVI()
 {
-  myErrorStatus = 0;
-
-  if(myFrameIndexes.size() < 2)
-    return;
-
-  size_t anId = 0, anEnd = myFrameIndexes.size() - 1;
+  myErrorStatus = SVTK_Recorder_NoError;
+  myNbWrittenFrames = 0;
+
+  SVTK_AVIWriter aWriter;
+  if(!aWriter.Open(QString::fromStdString(myName),myNbFPS))
+    myErrorStatus = SVTK_Recorder_WriteError;
+
+  // JPEG files are put into the movie and removed one by one;
+  // a frame is repeated in place of the skipped ones, unless it precedes a pause;
+  // the movie stops at the maximum size of AVI file, the rest of files is only removed
+  QByteArray aFrame;
+  size_t anId = 0, anEnd = myFrameIndexes.size();
   for(; anId < anEnd; anId++){
-    int aStartIndex = myFrameIndexes[anId];
-    if(aStartIndex < 0)
+    int anIndex = abs(myFrameIndexes[anId]);
+    std::string aName;
+    GetNameJPEG(myName,anIndex,aName);
+
+    QFile aFile(QString::fromStdString(aName));
+    if(aFile.open(QIODevice::ReadOnly)){
+      aFrame = aFile.readAll();
+      aFile.close();
+      aFile.remove();
+    }
+    if(aFrame.isEmpty() || myErrorStatus)
       continue;
 
-    int aFinishIndex = abs(myFrameIndexes[anId + 1]);
-    if(aStartIndex + 1 == aFinishIndex)
-      continue;
+    int aNbFrames = 1;
+    if(myUseSkippedFrames && myFrameIndexes[anId] >= 0 && anId + 1 < anEnd)
+      aNbFrames = std::max(1, abs(myFrameIndexes[anId + 1]) - anIndex);
 
-    std::string anInitialName;
-    std::ostringstream aStream;
-    GetNameJPEG(myName,aStartIndex,anInitialName);
-    for(int anIndex = aStartIndex + 1; anIndex < aFinishIndex; anIndex++){
-      myNbWrittenFrames++;
-      std::string anCurrentName;
-      GetNameJPEG(myName,anIndex,anCurrentName);
-  #ifndef WIN32
-      aStream<<"ln -s "<< anInitialName<<" "<<anCurrentName<<";";
-  #else
-      aStream<<"COPY /Y "<<QString::fromStdString(anInitialName).replace("/","\\\\").toStdString()<<
-		  " "<<QString::fromStdString(anCurrentName).replace("/","\\\\").toStdString()<<" > NUL";
-  #endif
-      if(anIndex + 1 < aFinishIndex) {
-  #ifndef WIN32
-        aStream<<" \\";
-        aStream<<endl;
-  #else
-        aStream<<" & ";
-  #endif
-      }
+    for(int i = 0; i < aNbFrames && !myErrorStatus; i++){
+      if(aWriter.AddFrame(aFrame))
+        myNbWrittenFrames++;
+      else
+        myErrorStatus = aWriter.IsFull() ? SVTK_Recorder_SizeLimit : SVTK_Recorder_WriteError;
     }
-    std::string aString(aStream.str());
-    system(aString.c_str());
-    if(SALOME::VerbosityActivated())
-      std::cout << "SVTK_Recorder::AddSkippedFrames - " << aString << endl;
   }
-}
-
-
-//----------------------------------------------------------------------------
-void
-SVTK_Recorder
-::MakeFileAVI()
-{
-  myErrorStatus = 0;
-  std::ostringstream aStream;
-  aStream<<myNameAVIMaker<<
-    " -I p"<<
-    " -v 0"<<
-    //" -f "<<int(myNbFPS)<<" "<<
-    " -f "<<myNbFPS<<" "<<
-    " -n "<<myNbWrittenFrames<<" "<<
-    " -j \""<<myName<<"_%06d.jpeg\" "<<
-    "| yuv2lav"<<" -o \""<<myName<<"\"";
-#ifdef WIN32
-  aStream<<" -f aA";
-#endif
-  std::string aString(aStream.str());
-  myErrorStatus = system(aString.c_str());
-
-  if(SALOME::VerbosityActivated())
-    std::cout << "SVTK_Recorder::MakeFileAVI - " << aString << endl;
 
-  QFileInfo aFileInfo(myName.c_str());
-  QString aDirPath = aFileInfo.absoluteDir().path();
-  QString aBaseName = aFileInfo.fileName();
-  QString aCommand;
-#ifndef WIN32
-  aCommand = QString("(cd ") + aDirPath +
-    "; ls " +
-    " | egrep '" + aBaseName + "_[0-9]*.jpeg'" +
-    " | xargs rm " +
-    ")";
-#else
-  QString tmpFile = QString("_") + aBaseName + "_tempfile";
-  QString diskName = aDirPath.split("/")[0];
-  aCommand = diskName + " && (cd " + aDirPath.replace("/","\\\\") +
-	" && ((dir /b | findstr " + aBaseName + "_[0-9]*.jpeg > " + tmpFile +
-	") & (for /f %i in (" + tmpFile + ") do (del \"%i\")) & (del " + tmpFile + "))) > NUL";
-#endif
+  if(!aWriter.Close())
+    myErrorStatus = SVTK_Recorder_WriteError;
 
   if(SALOME::VerbosityActivated())
-    std::cout << "SVTK_Recorder::MakeFileAVI - " << (const char*)aCommand.toUtf8() << endl;
-    
-  system((const char*)aCommand.toUtf8());
+    std::cout << "SVTK_Recorder::MakeFileAVI - " << myName <<
+    "; frames = " << myNbWrittenFrames << "; error = " << myErrorStatus << endl;
 }
@@ -41,6 +41,13 @@ class SVTK_Recorder : public vtkObject
   };
   
  public:
+  enum ErrorStatus {
+    SVTK_Recorder_NoError = 0,
+    SVTK_Recorder_WriteError = 1,       // AVI file can not be written
+    SVTK_Recorder_SizeLimit = 2,        // AVI file reached maximum size, the rest is not written
+    SVTK_Recorder_NoImage = 20          // image of render window is not available
+  };
+
   static SVTK_Recorder *New();
   vtkTypeMacro(SVTK_Recorder,vtkObject)
 
@@ -80,6 +87,12 @@ class SVTK_Recorder : public vtkObject
   bool
   UseSkippedFrames() const;
 
+  void
+  SetDropFrames(bool theDropFrames);
+
+  bool
+  DropFrames() const;
+
   void
   Record();
 
@@ -109,9 +122,6 @@ protected :
   void
   MakeFileAVI();
 
-  void
-  AddSkippedFrames();
-
   void
   PreWrite();
 
@@ -142,7 +152,6 @@ protected :
   bool myUseSkippedFrames;
 
   std::string myName;
-  std::string myNameAVIMaker;
 
   vtkCallbackCommand *myCommand;
   vtkRenderWindow *myRenderWindow;
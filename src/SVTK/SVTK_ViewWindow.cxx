@@ -2718,6 +2718,9 @@ void SVTK_ViewWindow::onStopRecording()
 
   setMinimumSize( myPreRecordingMinSize );
   setMaximumSize( myPreRecordingMaxSize );
+
+  if ( myRecorder->ErrorStatus() == SVTK_Recorder::SVTK_Recorder_SizeLimit )
+    SUIT_MessageBox::warning( this, tr( "WARNING" ), tr( "MSG_AVI_SIZE_LIMIT" ) );
 }
 
 /*!
@@ -0,0 +1,306 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "SVTK_AVIWriter.h"
+#include "SVTK_ImageWriterMgr.h"
+
+#include <vtkImageData.h>
+#include <vtkSmartPointer.h>
+
+#include <QBuffer>
+#include <QDataStream>
+#include <QDir>
+#include <QImage>
+
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+  // Makes JPEG image of a frame of the movie: gradient moving with the frame index
+  QByteArray MakeFrame(int theIndex, int theWidth, int theHeight)
+  {
+    QImage anImage(theWidth, theHeight, QImage::Format_RGB32);
+    for(int y = 0; y < theHeight; y++){
+      QRgb* aLine = (QRgb*)anImage.scanLine(y);
+      for(int x = 0; x < theWidth; x++)
+        aLine[x] = qRgb((x + theIndex) % 256, (y + 2 * theIndex) % 256, (x + y) % 256);
+    }
+
+    QByteArray aData;
+    QBuffer aBuffer(&aData);
+    aBuffer.open(QIODevice::WriteOnly);
+    anImage.save(&aBuffer, "JPG", 90);
+    return aData;
+  }
+
+  // Reads 32-bit value at the given position of the file
+  quint32 ReadUInt32(QFile& theFile, qint64 thePos)
+  {
+    quint32 aValue = 0;
+    theFile.seek(thePos);
+    QDataStream aStream(&theFile);
+    aStream.setByteOrder(QDataStream::LittleEndian);
+    aStream >> aValue;
+    return aValue;
+  }
+
+  // Fills RGB image data with a gradient moving with the frame index
+  void FillFrame(vtkImageData* theImageData, int theIndex)
+  {
+    int aDims[3];
+    theImageData->GetDimensions(aDims);
+    unsigned char* aPixel = (unsigned char*)theImageData->GetScalarPointer();
+    for(int y = 0; y < aDims[1]; y++)
+      for(int x = 0; x < aDims[0]; x++, aPixel += 3){
+        aPixel[0] = (x + theIndex) % 256;
+        aPixel[1] = (y + 2 * theIndex) % 256;
+        aPixel[2] = (x + y) % 256;
+      }
+    theImageData->Modified();
+  }
+
+  // Peak resident set size of the process, KB
+  long PeakRSS()
+  {
+#ifndef WIN32
+    struct rusage aUsage;
+    if(getrusage(RUSAGE_SELF, &aUsage) == 0)
+      return aUsage.ru_maxrss;
+#endif
+    return 0;
+  }
+}
+
+/*!
+  \class SVTKTest: test suit
+*/
+class SVTKTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( SVTKTest );
+  CPPUNIT_TEST( testAVIWriter );
+  CPPUNIT_TEST( testAVIWriterSizeLimit );
+  CPPUNIT_TEST( testImageWriterMgr );
+  CPPUNIT_TEST( testImageWriterMgrDrop );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void testAVIWriter();
+  void testAVIWriterSizeLimit();
+  void testImageWriterMgr();
+  void testImageWriterMgrDrop();
+};
+
+/*!
+  Measure time of encoding of frames and writing of them to AVI file
+  without render window, check sizes written to the file
+*/
+void SVTKTest::testAVIWriter()
+{
+  const int aNbFrames = 500;
+  const int aWidth = 640, aHeight = 480;
+  QString aFileName = QDir::temp().filePath( "TestSVTK_movie.avi" );
+
+  GuiTest_Timer aTimer( QString( "SVTK_AVIWriter with %1 frames %2x%3" ).arg( aNbFrames ).arg( aWidth ).arg( aHeight ) );
+
+  QList<QByteArray> aFrames;
+  for ( int i = 0; i < aNbFrames; i++ ) {
+    aFrames.append( MakeFrame( i, aWidth, aHeight ) );
+    CPPUNIT_ASSERT( !aFrames.last().isEmpty() );
+  }
+  qint64 anEncodeTime = aTimer.step( "encode" );
+
+  SVTK_AVIWriter aWriter;
+  CPPUNIT_ASSERT( aWriter.Open( aFileName, 25.0 ) );
+  for ( int i = 0; i < aNbFrames; i++ )
+    CPPUNIT_ASSERT( aWriter.AddFrame( aFrames[i] ) );
+  CPPUNIT_ASSERT( aWriter.Close() );
+  qint64 aWriteTime = aTimer.step( "write" );
+
+  CPPUNIT_ASSERT_EQUAL( aNbFrames, aWriter.NbFrames() );
+  CPPUNIT_ASSERT( !aWriter.IsFull() );
+
+  QFile aFile( aFileName );
+  CPPUNIT_ASSERT( aFile.open( QIODevice::ReadOnly ) );
+  qint64 aFileSize = aFile.size();
+  CPPUNIT_ASSERT_EQUAL( quint32( aFileSize - 8 ), ReadUInt32( aFile, 4 ) );            // RIFF size
+  CPPUNIT_ASSERT_EQUAL( quint32( aNbFrames ), ReadUInt32( aFile, 48 ) );               // avih total frames
+  CPPUNIT_ASSERT_EQUAL( quint32( aWidth ), ReadUInt32( aFile, 64 ) );                  // avih width
+  CPPUNIT_ASSERT_EQUAL( quint32( aHeight ), ReadUInt32( aFile, 68 ) );                 // avih height
+  aFile.close();
+  aFile.remove();
+
+  aTimer.note( QString( "encode %1 fps" ).arg( aNbFrames * 1000LL / anEncodeTime ) );
+  aTimer.note( QString( "write %1 fps" ).arg( aNbFrames * 1000LL / aWriteTime ) );
+  aTimer.note( QString( "%1 KB" ).arg( aFileSize / 1024 ) );
+  aTimer.print();
+}
+
+/*!
+  Check that frames exceeding maximum size of AVI file are not written
+  and the file stays valid
+*/
+void SVTKTest::testAVIWriterSizeLimit()
+{
+  QString aFileName = QDir::temp().filePath( "TestSVTK_limit.avi" );
+  QByteArray aFrame = MakeFrame( 0, 320, 240 );
+  const qint64 aMaxSize = 10 * aFrame.size() + 1024;
+
+  // maximum size is bounded by 32-bit sizes of AVI 1.0
+  SVTK_AVIWriter aWriter;
+  CPPUNIT_ASSERT_EQUAL( SVTK_AVIWriter::DefaultMaxFileSize, aWriter.MaxFileSize() );
+  aWriter.SetMaxFileSize( Q_INT64_C(1) << 40 );
+  CPPUNIT_ASSERT_EQUAL( Q_INT64_C(0xFFFFFFFF), aWriter.MaxFileSize() );
+  aWriter.SetMaxFileSize( aMaxSize );
+
+  CPPUNIT_ASSERT( aWriter.Open( aFileName, 25.0 ) );
+  int aNbWritten = 0;
+  while ( aWriter.AddFrame( aFrame ) )
+    aNbWritten++;
+  CPPUNIT_ASSERT( aWriter.IsFull() );
+  CPPUNIT_ASSERT( !aWriter.AddFrame( aFrame ) );
+  CPPUNIT_ASSERT( aWriter.Close() );
+  CPPUNIT_ASSERT( aNbWritten > 0 && aNbWritten <= 10 );
+  CPPUNIT_ASSERT_EQUAL( aNbWritten, aWriter.NbFrames() );
+
+  QFile aFile( aFileName );
+  CPPUNIT_ASSERT( aFile.open( QIODevice::ReadOnly ) );
+  CPPUNIT_ASSERT( aFile.size() <= aMaxSize );
+  CPPUNIT_ASSERT_EQUAL( quint32( aFile.size() - 8 ), ReadUInt32( aFile, 4 ) );
+  CPPUNIT_ASSERT_EQUAL( quint32( aNbWritten ), ReadUInt32( aFile, 48 ) );
+  aFile.close();
+  aFile.remove();
+
+  // reopening resets the limit status
+  CPPUNIT_ASSERT( aWriter.Open( aFileName, 25.0 ) );
+  CPPUNIT_ASSERT( !aWriter.IsFull() );
+  CPPUNIT_ASSERT( aWriter.AddFrame( aFrame ) );
+  CPPUNIT_ASSERT( aWriter.Close() );
+  QFile::remove( aFileName );
+}
+
+/*!
+  Feed synthetic frames to the writer pool which waits for a free place
+  in the queue: check that the queue stays bounded and all frames are
+  written, measure sustained frame rate and peak memory
+*/
+void SVTKTest::testImageWriterMgr()
+{
+  const int aNbFrames = 300;
+  const int aWidth = 640, aHeight = 480;
+  QDir aDir( QDir::temp().filePath( "TestSVTK_frames" ) );
+  aDir.removeRecursively();
+  CPPUNIT_ASSERT( aDir.mkpath( "." ) );
+
+  vtkSmartPointer<vtkImageData> anImageData = vtkSmartPointer<vtkImageData>::New();
+  anImageData->SetDimensions( aWidth, aHeight, 1 );
+  anImageData->AllocateScalars( VTK_UNSIGNED_CHAR, 3 );
+
+  GuiTest_Timer aTimer( QString( "SVTK_ImageWriterMgr with %1 frames %2x%3" ).arg( aNbFrames ).arg( aWidth ).arg( aHeight ) );
+  long aStartRSS = PeakRSS();
+  int aMaxQueueSize = 0, aMaxQueued = 0;
+  {
+    SVTK_ImageWriterMgr aMgr;
+    aMaxQueueSize = aMgr.MaxQueueSize();
+    CPPUNIT_ASSERT( aMaxQueueSize > 0 );
+    CPPUNIT_ASSERT( !aMgr.DropFrames() );
+
+    aTimer.restart();
+    for ( int i = 0; i < aNbFrames; i++ ) {
+      FillFrame( anImageData, i );
+      std::string aName = aDir.filePath( QString( "frame_%1.jpeg" ).arg( i, 4, 10, QChar( '0' ) ) ).toStdString();
+      CPPUNIT_ASSERT( aMgr.StartImageWriter( anImageData, aName, 0, 95 ) );
+      aMaxQueued = qMax( aMaxQueued, aMgr.NbQueuedFrames() );
+    }
+    aMgr.Stop();
+    qint64 aTime = aTimer.step( "write" );
+
+    CPPUNIT_ASSERT( aMaxQueued <= aMaxQueueSize );
+    CPPUNIT_ASSERT_EQUAL( 0, aMgr.NbQueuedFrames() );
+    CPPUNIT_ASSERT_EQUAL( 0, aMgr.NbDroppedFrames() );
+    aTimer.note( QString( "%1 fps" ).arg( aNbFrames * 1000LL / aTime ) );
+  }
+  CPPUNIT_ASSERT_EQUAL( aNbFrames, (int)aDir.entryList( QStringList( "*.jpeg" ), QDir::Files ).count() );
+  aDir.removeRecursively();
+
+  aTimer.note( QString( "queue %1 of %2" ).arg( aMaxQueued ).arg( aMaxQueueSize ) );
+  aTimer.note( QString( "peak RSS %1 KB (+%2 KB)" ).arg( PeakRSS() ).arg( PeakRSS() - aStartRSS ) );
+  aTimer.print();
+}
+
+/*!
+  Feed synthetic frames to the writer pool which drops frames when
+  the queue is full: check that dropped frames are counted and not
+  written, measure sustained frame rate and peak memory
+*/
+void SVTKTest::testImageWriterMgrDrop()
+{
+  const int aNbFrames = 300;
+  const int aWidth = 1280, aHeight = 960;
+  QDir aDir( QDir::temp().filePath( "TestSVTK_dropped" ) );
+  aDir.removeRecursively();
+  CPPUNIT_ASSERT( aDir.mkpath( "." ) );
+
+  vtkSmartPointer<vtkImageData> anImageData = vtkSmartPointer<vtkImageData>::New();
+  anImageData->SetDimensions( aWidth, aHeight, 1 );
+  anImageData->AllocateScalars( VTK_UNSIGNED_CHAR, 3 );
+  FillFrame( anImageData, 0 );
+
+  GuiTest_Timer aTimer( QString( "SVTK_ImageWriterMgr dropping frames, %1 frames %2x%3" ).arg( aNbFrames ).arg( aWidth ).arg( aHeight ) );
+  int aNbRejected = 0, aMaxQueued = 0, aNbDropped = 0;
+  {
+    SVTK_ImageWriterMgr aMgr;
+    aMgr.SetMaxQueueSize( 0 );  // bounded to one frame
+    CPPUNIT_ASSERT_EQUAL( 1, aMgr.MaxQueueSize() );
+    aMgr.SetDropFrames( true );
+
+    aTimer.restart();
+    for ( int i = 0; i < aNbFrames; i++ ) {
+      std::string aName = aDir.filePath( QString( "frame_%1.jpeg" ).arg( i, 4, 10, QChar( '0' ) ) ).toStdString();
+      if ( !aMgr.StartImageWriter( anImageData, aName, 0, 95 ) )
+        aNbRejected++;
+      aMaxQueued = qMax( aMaxQueued, aMgr.NbQueuedFrames() );
+    }
+    aMgr.Stop();
+    qint64 aTime = aTimer.step( "write" );
+
+    aNbDropped = aMgr.NbDroppedFrames();
+    CPPUNIT_ASSERT( aMaxQueued <= 1 );
+    CPPUNIT_ASSERT_EQUAL( aNbRejected, aNbDropped );
+    aTimer.note( QString( "%1 fps offered" ).arg( aNbFrames * 1000LL / aTime ) );
+    aTimer.note( QString( "%1 fps written" ).arg( ( aNbFrames - aNbDropped ) * 1000LL / aTime ) );
+  }
+  CPPUNIT_ASSERT_EQUAL( aNbFrames - aNbDropped, (int)aDir.entryList( QStringList( "*.jpeg" ), QDir::Files ).count() );
+  aDir.removeRecursively();
+
+  aTimer.note( QString( "%1 dropped" ).arg( aNbDropped ) );
+  aTimer.note( QString( "peak RSS %1 KB" ).arg( PeakRSS() ) );
+  aTimer.print();
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SVTKTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"
@@ -27,6 +27,10 @@
         <source>ERROR</source>
         <translation>Error</translation>
     </message>
+    <message>
+        <source>WARNING</source>
+        <translation>Warning</translation>
+    </message>
     <message>
         <source>MNU_DUMP_VIEW</source>
         <translation>Dump view...</translation>
@@ -346,6 +350,11 @@
         <translation>Tool jpeg2yuv, necessary for AVI recording, is not available.
 Please, refer to the documentation.</translation>
     </message>
+    <message>
+        <source>MSG_AVI_SIZE_LIMIT</source>
+        <translation>The maximum size of AVI file has been reached.
+The end of recording is not saved.</translation>
+    </message>
 </context>
 <context>
     <name>SVTK_NonIsometricDlg</name>
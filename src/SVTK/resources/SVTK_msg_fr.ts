@@ -27,6 +27,10 @@
         <source>ERROR</source>
         <translation>Erreur</translation>
     </message>
+    <message>
+        <source>WARNING</source>
+        <translation>Avertissement</translation>
+    </message>
     <message>
         <source>MNU_DUMP_VIEW</source>
         <translation>Sauvegarder la scène...</translation>
@@ -346,6 +350,11 @@
         <translation>L&apos;outil jpeg2yuv, requis pour enregistrer les fichiers AVI, n&apos;est pas disponible.
 Veuillez consulter la documentation.</translation>
     </message>
+    <message>
+        <source>MSG_AVI_SIZE_LIMIT</source>
+        <translation>La taille maximale du fichier AVI a été atteinte.
+La fin de l&apos;enregistrement n&apos;est pas sauvegardée.</translation>
+    </message>
 </context>
 <context>
     <name>SVTK_NonIsometricDlg</name>
@@ -27,6 +27,10 @@
       <source>ERROR</source>
       <translation>エラー</translation>
     </message>
+    <message>
+      <source>WARNING</source>
+      <translation>警告</translation>
+    </message>
     <message>
       <source>MNU_DUMP_VIEW</source>
       <translation>表示状態の保存</translation>
@@ -345,6 +349,11 @@
       <source>MSG_NO_AVI_MAKER</source>
       <translation>AVI ファイルを保存するために必要な jpeg2yuv ツールは利用できません。マニュアルを参照してください。</translation>
     </message>
+    <message>
+      <source>MSG_AVI_SIZE_LIMIT</source>
+      <translation>AVI ファイルの最大サイズに達しました。
+録画の終わりは保存されていません。</translation>
+    </message>
   </context>
   <context>
     <name>SVTK_NonIsometricDlg</name>
@@ -43,6 +43,8 @@
 #endif
 #include "SalomeApp_Application.h"
 #include "SalomeApp_Study.h"
+#include "SalomeApp_Module.h"
+#include "SalomeApp_NoteBookGraph.h"
 #include "SalomeApp_DataModel.h"
 #include "SalomeApp_DataObject.h"
 #include "SalomeApp_VisualState.h"
@@ -1133,6 +1135,7 @@ QWidget* SalomeApp_Application::createWindow( const int flag )
     pyCons->setFont(resourceMgr()->fontValue( "PyConsole", "font" ));
     pyCons->setIsShowBanner(resourceMgr()->booleanValue( "PyConsole", "show_banner", true ));
     pyCons->setAutoCompletion( resMgr->booleanValue( "PyConsole", "auto_completion", true ) );
+    pyCons->setMaxLines( resMgr->integerValue( "PyConsole", "max_lines", 0 ) );
     pyCons->setProperty( "shortcut", QKeySequence( "Alt+Shift+P" ) );
     wid = pyCons;
   }
@@ -2048,6 +2051,11 @@ bool SalomeApp_Application::updateStudy()
   if ( !study || !myNoteBook )
     return false;
 
+  if ( updateNoteBookObjects( study ) )
+    return true;
+  // the whole study is re-created below
+  myNoteBook->clearChangedVariables();
+
   myNoteBook->setIsDumpedStudySaved( study->isSaved() );
   myNoteBook->setDumpedStudyName( study->studyName() );
 
@@ -2130,6 +2138,54 @@ bool SalomeApp_Application::updateStudy()
 
   return ok;
 }
+
+//============================================================================
+/*! Function : updateNoteBookObjects
+ *  Purpose  : Re-execute only operations depending on variables changed in NoteBook.
+ *             Returns false if the study has to be rebuilt from its dump instead.
+ */
+//============================================================================
+bool SalomeApp_Application::updateNoteBookObjects( SalomeApp_Study* study )
+{
+  // variables changed outside of NoteBook (e.g. from Python console) are unknown
+  QStringList aChanged = myNoteBook->changedVariables();
+  if ( aChanged.isEmpty() )
+    return false;
+
+  // removed and renamed variables are still referred to by the objects built from them
+  SalomeApp_NoteBookGraph aGraph;
+  study->buildNoteBookGraph( aGraph, aChanged );
+
+  // objects without parameters do not tell what they consumed: nothing proves
+  // that the study does not depend on the changed variables
+  if ( !aGraph.hasConsumers() )
+    return false;
+  QStringList aDirty = aGraph.dirtyObjects( aChanged );
+  if ( aDirty.isEmpty() )
+    return false;
+
+  // split dirty objects into runs belonging to the same module, keeping their order
+  QList< QPair<SalomeApp_Module*, QStringList> > aRuns;
+  foreach ( QString anEntry, aDirty ) {
+    SalomeApp_Module* aModule =
+      dynamic_cast<SalomeApp_Module*>( module( moduleTitle( study->componentDataType( anEntry ) ) ) );
+    if ( !aModule )
+      return false;
+    if ( aRuns.isEmpty() || aRuns.last().first != aModule )
+      aRuns.append( qMakePair( aModule, QStringList() ) );
+    aRuns.last().second.append( anEntry );
+  }
+
+  for ( int i = 0; i < aRuns.count(); i++ ) {
+    if ( !aRuns[i].first->updateNoteBookObjects( aRuns[i].second ) )
+      return false;
+  }
+
+  myNoteBook->clearChangedVariables();
+  updateObjectBrowser( true );
+  study->Modified();
+  return true;
+}
 #endif
 
 //============================================================================
@@ -210,6 +210,10 @@ private:
   QString                             getScriptFileName();
   void                                execScript(const bool isNewDoc);
 
+#ifndef DISABLE_PYCONSOLE
+  bool                                updateNoteBookObjects( SalomeApp_Study* );
+#endif
+
 private:
 #ifndef DISABLE_PYCONSOLE
   QPointer<SalomeApp_NoteBook>        myNoteBook;        // Notebook instance
@@ -148,3 +148,17 @@ void SalomeApp_Module::storeVisualParameters(int /*savePoint*/)
 void SalomeApp_Module::restoreVisualParameters(int /*savePoint*/)
 {
 }
+
+/*!
+ * \brief Virtual public
+ *
+ * This method is called when NoteBook variables consumed by objects of the module are changed,
+ * so the module has a possibility to re-execute only the operations which created these objects.
+ * \param theEntries entries of the objects to recompute, in order of their creation
+ * \return \c true if the objects have been recomputed; \c false (default) means
+ * that the study has to be rebuilt from its Python dump
+ */
+bool SalomeApp_Module::updateNoteBookObjects( const QStringList& /*theEntries*/ )
+{
+  return false;
+}
@@ -36,6 +36,7 @@ class SalomeApp_Application;
 class LightApp_Selection;
 class SALOME_ListIO;
 class QString;
+class QStringList;
 class SUIT_DataObject;
 
 /*!
@@ -62,6 +63,7 @@ public:
 
   virtual void                        storeVisualParameters(int savePoint);
   virtual void                        restoreVisualParameters(int savePoint);
+  virtual bool                        updateNoteBookObjects( const QStringList& );
   virtual LightApp_Selection*         createSelection() const;
   
 protected:
@@ -850,6 +850,8 @@ void SalomeApp_NoteBook::onApply()
     {
       QString aRemovedVariable = aVariableMapRef[ anIndex ].Name;
       aStudy->RemoveVariable( std::string( aRemovedVariable.toUtf8().constData() ) );
+      if( !myChangedVariables.contains( aRemovedVariable ) )
+        myChangedVariables.append( aRemovedVariable );
     }
   }
 
@@ -873,8 +875,14 @@ void SalomeApp_NoteBook::onApply()
         {
           aStudy->RenameVariable( std::string( aNameRef.toUtf8().constData() ),
                                   std::string( aName.toUtf8().constData() ) );
+          if( !myChangedVariables.contains( aNameRef ) )
+            myChangedVariables.append( aNameRef );
         }
+        if( ( aNameRef != aName || aValueRef != aValue ) && !myChangedVariables.contains( aName ) )
+          myChangedVariables.append( aName );
       }
+      else if( !myChangedVariables.contains( aName ) )
+        myChangedVariables.append( aName );
 
       if( NoteBook_TableRow::IsIntegerValue(aValue,&anIVal) )
         aStudy->SetInteger(std::string(aName.toUtf8().constData()),anIVal);
@@ -32,6 +32,7 @@
 #include <QWidget>
 #include <QTableWidget>
 #include <QList>
+#include <QStringList>
 
 class QWidget;
 class QPushButton;
@@ -155,6 +156,10 @@ class SALOMEAPPIMPL_EXPORT SalomeApp_NoteBook : public QWidget
 
   bool isDumpedStudySaved() { return myIsDumpedStudySaved; }
   void setIsDumpedStudySaved(bool isSaved) { myIsDumpedStudySaved = isSaved; }
+
+  // variables changed, renamed or removed since the last update of the study
+  const QStringList& changedVariables() const { return myChangedVariables; }
+  void clearChangedVariables() { myChangedVariables.clear(); }
   
  public slots:
    void onApply();
@@ -170,6 +175,7 @@ class SALOMEAPPIMPL_EXPORT SalomeApp_NoteBook : public QWidget
   QString          myDumpedStudyScript; // path to script of dumped study
   QString          myDumpedStudyName;
   bool             myIsDumpedStudySaved;
+  QStringList      myChangedVariables;
 };
 
 #endif //SALOMEAPP_NOTEBOOK_H
@@ -0,0 +1,247 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+// File:    SalomeApp_NoteBookGraph.cxx
+// Module : GUI
+//
+#include "SalomeApp_NoteBookGraph.h"
+
+#include <QMap>
+
+/*!
+  \brief Constructor.
+*/
+SalomeApp_NoteBookGraph::SalomeApp_NoteBookGraph()
+{
+}
+
+/*!
+  \brief Removes all variables, objects and dependencies.
+*/
+void SalomeApp_NoteBookGraph::clear()
+{
+  myVariableUsers.clear();
+  myConsumers.clear();
+  myDependants.clear();
+  myOrder.clear();
+}
+
+/*!
+  \return \c true if no object has been recorded
+*/
+bool SalomeApp_NoteBookGraph::isEmpty() const
+{
+  return myOrder.isEmpty();
+}
+
+/*!
+  \return number of recorded objects
+*/
+int SalomeApp_NoteBookGraph::nbObjects() const
+{
+  return myOrder.count();
+}
+
+/*!
+  \return \c true if at least one object consumed a variable
+*/
+bool SalomeApp_NoteBookGraph::hasConsumers() const
+{
+  return !myConsumers.isEmpty();
+}
+
+/*!
+  \brief Records variables used in the value of variable.
+  \param theName variable name
+  \param theUsedVariables variables used in the value of variable
+*/
+void SalomeApp_NoteBookGraph::setVariable( const QString& theName, const QStringList& theUsedVariables )
+{
+  foreach ( const QString& aUsed, theUsedVariables ) {
+    QStringList& aUsers = myVariableUsers[ aUsed ];
+    if ( aUsed != theName && !aUsers.contains( theName ) )
+      aUsers.append( theName );
+  }
+}
+
+/*!
+  \brief Records object which consumed variables.
+
+  Objects should be recorded in order of their creation, it is the order
+  in which dirty objects are returned by dirtyObjects().
+  \param theEntry object entry
+  \param theVariables variables consumed by object
+*/
+void SalomeApp_NoteBookGraph::addObject( const QString& theEntry, const QStringList& theVariables )
+{
+  registerObject( theEntry );
+  foreach ( const QString& aVariable, theVariables )
+    myConsumers[ aVariable ].append( theEntry );
+}
+
+/*!
+  \brief Records that object has been built from another object.
+  \param theEntry entry of dependent object
+  \param theSource entry of object it has been built from
+*/
+void SalomeApp_NoteBookGraph::addDependency( const QString& theEntry, const QString& theSource )
+{
+  registerObject( theSource );
+  registerObject( theEntry );
+  if ( theEntry != theSource )
+    myDependants[ theSource ].append( theEntry );
+}
+
+/*!
+  \brief Gets variables which values depend on given variables.
+  \param theVariables changed variables
+  \return given variables and all variables using them, directly or not
+*/
+QStringList SalomeApp_NoteBookGraph::dependentVariables( const QStringList& theVariables ) const
+{
+  QStringList aResult;
+  QSet<QString> aVisited;
+  foreach ( const QString& aVariable, theVariables ) {
+    if ( !aVisited.contains( aVariable ) ) {
+      aVisited.insert( aVariable );
+      aResult.append( aVariable );
+    }
+  }
+
+  // the list grows while it is walked: breadth-first traversal
+  for ( int i = 0; i < aResult.count(); i++ ) {
+    QHash<QString, QStringList>::const_iterator it = myVariableUsers.constFind( aResult[ i ] );
+    if ( it == myVariableUsers.constEnd() )
+      continue;
+    foreach ( const QString& aUser, it.value() ) {
+      if ( !aVisited.contains( aUser ) ) {
+        aVisited.insert( aUser );
+        aResult.append( aUser );
+      }
+    }
+  }
+  return aResult;
+}
+
+/*!
+  \brief Gets objects to be recomputed when variables are changed.
+
+  These are the objects which consumed changed variables (or variables
+  depending on them) and all objects built from them.
+  \param theVariables changed variables
+  \return entries of dirty objects in order of their recording
+*/
+QStringList SalomeApp_NoteBookGraph::dirtyObjects( const QStringList& theVariables ) const
+{
+  QStringList aDirty;
+  QSet<QString> aVisited;
+  foreach ( const QString& aVariable, dependentVariables( theVariables ) ) {
+    QHash<QString, QStringList>::const_iterator it = myConsumers.constFind( aVariable );
+    if ( it == myConsumers.constEnd() )
+      continue;
+    foreach ( const QString& anEntry, it.value() ) {
+      if ( !aVisited.contains( anEntry ) ) {
+        aVisited.insert( anEntry );
+        aDirty.append( anEntry );
+      }
+    }
+  }
+
+  for ( int i = 0; i < aDirty.count(); i++ ) {
+    QHash<QString, QStringList>::const_iterator it = myDependants.constFind( aDirty[ i ] );
+    if ( it == myDependants.constEnd() )
+      continue;
+    foreach ( const QString& anEntry, it.value() ) {
+      if ( !aVisited.contains( anEntry ) ) {
+        aVisited.insert( anEntry );
+        aDirty.append( anEntry );
+      }
+    }
+  }
+
+  QMap<int, QString> anOrdered;
+  foreach ( const QString& anEntry, aDirty )
+    anOrdered.insert( myOrder.value( anEntry ), anEntry );
+  return anOrdered.values();
+}
+
+/*!
+  \brief Gets variables from the parameters string stored by modules on study objects.
+
+  The string consists of sections separated by '|', each section contains
+  parameter values separated by ':'; only names of existing variables are kept.
+  \param theParameters parameters string
+  \param theVariables names of NoteBook variables
+  \return variables consumed by object, without repetitions
+*/
+QStringList SalomeApp_NoteBookGraph::parseParameters( const QString& theParameters,
+                                                      const QSet<QString>& theVariables )
+{
+  QStringList aResult;
+  foreach ( const QString& aSection, theParameters.split( "|", QString::SkipEmptyParts ) ) {
+    foreach ( const QString& aValue, aSection.split( ":", QString::SkipEmptyParts ) ) {
+      QString aName = aValue.trimmed();
+      if ( theVariables.contains( aName ) && !aResult.contains( aName ) )
+        aResult.append( aName );
+    }
+  }
+  return aResult;
+}
+
+/*!
+  \brief Gets variables used in an expression.
+  \param theExpression value of variable
+  \param theVariables names of NoteBook variables
+  \return variables used in expression, without repetitions
+*/
+QStringList SalomeApp_NoteBookGraph::usedVariables( const QString& theExpression,
+                                                    const QSet<QString>& theVariables )
+{
+  QStringList aResult;
+  int aLength = theExpression.length();
+  for ( int i = 0; i < aLength; ) {
+    QChar aChar = theExpression[ i ];
+    if ( !aChar.isLetter() && aChar != '_' ) {
+      // skip numbers entirely, so that exponents like '1e5' are not taken for names
+      if ( aChar.isDigit() )
+        while ( i < aLength && ( theExpression[ i ].isLetterOrNumber() || theExpression[ i ] == '_' ) )
+          i++;
+      else
+        i++;
+      continue;
+    }
+    int aStart = i;
+    while ( i < aLength && ( theExpression[ i ].isLetterOrNumber() || theExpression[ i ] == '_' ) )
+      i++;
+    QString aName = theExpression.mid( aStart, i - aStart );
+    if ( theVariables.contains( aName ) && !aResult.contains( aName ) )
+      aResult.append( aName );
+  }
+  return aResult;
+}
+
+/*!
+  \brief Assigns recording order to object seen for the first time.
+  \param theEntry object entry
+*/
+void SalomeApp_NoteBookGraph::registerObject( const QString& theEntry )
+{
+  if ( !myOrder.contains( theEntry ) )
+    myOrder.insert( theEntry, myOrder.count() );
+}
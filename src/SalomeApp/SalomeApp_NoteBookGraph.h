@@ -0,0 +1,71 @@
+// Copyright (C) 2007-2026  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+// File:    SalomeApp_NoteBookGraph.h
+// Module : GUI
+//
+#ifndef SALOMEAPP_NOTEBOOKGRAPH_H
+#define SALOMEAPP_NOTEBOOKGRAPH_H
+
+#include "SalomeApp.h"
+
+#include <QHash>
+#include <QSet>
+#include <QStringList>
+
+/*!
+  \class SalomeApp_NoteBookGraph
+  \brief Dependencies of study objects on NoteBook variables.
+
+  The graph records which variables are used in values of other variables,
+  which objects consumed which variables and which objects have been built
+  from other objects. It gives the set of objects to be recomputed when
+  some variables are changed.
+*/
+class SALOMEAPPIMPL_EXPORT SalomeApp_NoteBookGraph
+{
+public:
+  SalomeApp_NoteBookGraph();
+
+  void               clear();
+  bool               isEmpty() const;
+  int                nbObjects() const;
+  bool               hasConsumers() const;
+
+  void               setVariable( const QString&, const QStringList& );
+  void               addObject( const QString&, const QStringList& );
+  void               addDependency( const QString&, const QString& );
+
+  QStringList        dependentVariables( const QStringList& ) const;
+  QStringList        dirtyObjects( const QStringList& ) const;
+
+  static QStringList parseParameters( const QString&, const QSet<QString>& );
+  static QStringList usedVariables( const QString&, const QSet<QString>& );
+
+private:
+  void               registerObject( const QString& );
+
+private:
+  QHash<QString, QStringList> myVariableUsers; //!< variable -> variables using it in their values
+  QHash<QString, QStringList> myConsumers;     //!< variable -> objects which consumed it
+  QHash<QString, QStringList> myDependants;    //!< object -> objects built from it
+  QHash<QString, int>         myOrder;         //!< object -> order of recording
+};
+
+#endif // SALOMEAPP_NOTEBOOKGRAPH_H
@@ -32,6 +32,7 @@
 #include "SalomeApp_Application.h"
 #include "SalomeApp_Engine_i.h"
 #include "SalomeApp_VisualState.h"
+#include "SalomeApp_NoteBookGraph.h"
 
 // temporary commented
 //#include <OB_Browser.h>
@@ -1218,6 +1219,73 @@ bool SalomeApp_Study::isComponent( const QString& entry ) const
   return obj && QString( obj->GetID().c_str() ) == obj->GetFatherComponent()->GetID().c_str();
 }
 
+/*!
+  \brief Fills graph of dependencies of study objects on NoteBook variables.
+
+  Variables consumed by an object are taken from the parameters string stored
+  by modules on the object; an object depends on the object it refers to
+  and on its father, unless the father is a component.
+
+  Objects still refer to variables removed or renamed since they were built,
+  these old names are to be given in addition to the current variables.
+  \param theGraph graph to fill, it is cleared first
+  \param theOldVariables names of variables which do not exist any more
+*/
+void SalomeApp_Study::buildNoteBookGraph( SalomeApp_NoteBookGraph& theGraph,
+                                          const QStringList& theOldVariables ) const
+{
+  theGraph.clear();
+
+  _PTR(Study) aStudy = studyDS();
+  if ( !aStudy )
+    return;
+
+  QSet<QString> aVariables;
+  std::vector<std::string> aNames = aStudy->GetVariableNames();
+  for ( size_t i = 0; i < aNames.size(); i++ )
+    aVariables.insert( QString::fromStdString( aNames[i] ) );
+  QSet<QString> aCurrent = aVariables;
+  foreach ( const QString& aName, theOldVariables )
+    aVariables.insert( aName );
+
+  foreach ( const QString& aName, aCurrent ) {
+    std::string aVarName = aName.toStdString();
+    if ( aStudy->IsString( aVarName ) )
+      theGraph.setVariable( aName, SalomeApp_NoteBookGraph::usedVariables(
+                              QString::fromStdString( aStudy->GetString( aVarName ) ), aVariables ) );
+  }
+
+  for ( _PTR(SComponentIterator) aCompIt ( aStudy->NewComponentIterator() ); aCompIt->More(); aCompIt->Next() ) {
+    _PTR(SComponent) aComponent ( aCompIt->Value() );
+    QString aCompEntry = aComponent->GetID().c_str();
+
+    // all levels are walked depth-first, so fathers are recorded before their children
+    _PTR(ChildIterator) anIter ( aStudy->NewChildIterator( aComponent ) );
+    for ( anIter->InitEx( true ); anIter->More(); anIter->Next() ) {
+      _PTR(SObject) anObj ( anIter->Value() );
+      QString anEntry = anObj->GetID().c_str();
+
+      QStringList aConsumed;
+      _PTR(GenericAttribute) anAttr;
+      if ( !aVariables.isEmpty() && anObj->FindAttribute( anAttr, "AttributeString" ) ) {
+        _PTR(AttributeString) aStrAttr = anAttr;
+        aConsumed = SalomeApp_NoteBookGraph::parseParameters(
+          QString::fromUtf8( aStrAttr->Value().c_str() ), aVariables );
+      }
+
+      _PTR(SObject) aFather ( anObj->GetFather() );
+      if ( aFather && aFather->GetID().c_str() != aCompEntry )
+        theGraph.addDependency( anEntry, aFather->GetID().c_str() );
+
+      _PTR(SObject) aRefObj;
+      if ( anObj->ReferencedObject( aRefObj ) )
+        theGraph.addDependency( anEntry, aRefObj->GetID().c_str() );
+
+      theGraph.addObject( anEntry, aConsumed );
+    }
+  }
+}
+
 /*!
   \return entries of object children
 */
@@ -1294,6 +1362,8 @@ std::vector<int> SalomeApp_Study::getSavePoints()
 void SalomeApp_Study::removeSavePoint(int savePoint)
 {
   if(savePoint <= 0) return;
+  // states stored as differences with the removed one must not depend on it any more
+  SalomeApp_VisualState::detachStates(this, savePoint);
  _PTR(AttributeParameter) AP = studyDS()->GetCommonParameters(getVisualComponentName().toLatin1().constData(), savePoint);
   _PTR(SObject) so = AP->GetSObject();
   _PTR(StudyBuilder) builder = studyDS()->NewBuilder();
@@ -33,6 +33,8 @@
 
 #include "SALOMEDSClient.hxx"
 
+class SalomeApp_NoteBookGraph;
+
 class SALOMEAPPIMPL_EXPORT SalomeApp_Study : public LightApp_Study
 {
   Q_OBJECT
@@ -76,6 +78,8 @@ public:
   virtual void        components( QStringList& ) const;
   virtual QString     centry( const QString& ) const;
 
+  void                buildNoteBookGraph( SalomeApp_NoteBookGraph&, const QStringList& = QStringList() ) const;
+
   std::vector<int>    getSavePoints();
   void                removeSavePoint(int savePoint);
   QString             getNameOfSavePoint(int savePoint);
@@ -30,7 +30,9 @@
 #include <SUIT_ResourceMgr.h>
 #include <SUIT_ViewManager.h>
 #include <SUIT_ViewWindow.h>
+#include <SUIT_ViewModel.h>
 #include <QtxWorkstack.h>
+#include <SALOME_Prs.h>
 
 #include <STD_TabDesktop.h>
 
@@ -41,10 +43,89 @@
 #include <SALOMEDSClient_ClientFactory.hxx>//?
 #include <SALOMEDSClient_IParameters.hxx>//?
 
+#include <algorithm>
 #include <vector>//?
 #include <string>//?
 #include <cstdio>
 
+namespace
+{
+  // save point which state is the base of the differential state
+  const char* BASE_STATE = "AP_BASE_STATE";
+  // value which is the same as in the base state
+  const std::string SAME_AS_BASE = "=";
+  // maximal length of chain of differential states
+  const int MAX_BASE_DEPTH = 16;
+  // version of format of the state
+  const char* STATE_VERSION = "AP_STATE_VERSION";
+  // differential states are supported since version 2
+  const int CURRENT_STATE_VERSION = 2;
+
+  _PTR(IParameters) stateParameters( SalomeApp_Study* study, int savePoint )
+  {
+    _PTR(AttributeParameter) ap = study->studyDS()->GetCommonParameters( study->getVisualComponentName().toLatin1().constData(),
+                                                                         savePoint );
+    return ClientFactory::getIParameters( ap );
+  }
+
+  int baseState( _PTR(IParameters) ip, const std::vector<int>& savePoints )
+  {
+    int base = QString( ip->getProperty( BASE_STATE ).c_str() ).toInt();
+    return std::find( savePoints.begin(), savePoints.end(), base ) != savePoints.end() ? base : 0;
+  }
+
+  int stateDepth( SalomeApp_Study* study, int savePoint, const std::vector<int>& savePoints )
+  {
+    int depth = 0;
+    for ( int base = savePoint; base > 0 && depth <= MAX_BASE_DEPTH; depth++ )
+      base = baseState( stateParameters( study, base ), savePoints );
+    return depth;
+  }
+
+  /*!
+    Checks that all base states of the differential state are available
+  */
+  bool isStateComplete( SalomeApp_Study* study, _PTR(IParameters) ip, const std::vector<int>& savePoints )
+  {
+    for ( int depth = 0; depth <= MAX_BASE_DEPTH; depth++ )
+    {
+      int base = QString( ip->getProperty( BASE_STATE ).c_str() ).toInt();
+      if ( base <= 0 )
+        return true;
+      if ( std::find( savePoints.begin(), savePoints.end(), base ) == savePoints.end() )
+        return false;
+      ip = stateParameters( study, base );
+    }
+    return false;
+  }
+
+  /*!
+    Gets value of the list item (or of the property if index is negative),
+    looking for it in the base states if it has not been changed
+  */
+  std::string resolvedValue( SalomeApp_Study* study, _PTR(IParameters) ip, const std::vector<int>& savePoints,
+                             const std::string& name, int index )
+  {
+    std::string value;
+    for ( int depth = 0; depth <= MAX_BASE_DEPTH; depth++ )
+    {
+      if ( index < 0 )
+        value = ip->getProperty( name );
+      else
+        value = index < ip->nbValues( name ) ? ip->getValue( name, index ) : std::string();
+
+      if ( value != SAME_AS_BASE )
+        return value;
+
+      int base = baseState( ip, savePoints );
+      if ( base <= 0 )
+        break;
+      ip = stateParameters( study, base );
+    }
+    return std::string();
+  }
+}
+
 /*!
   Constructor.
 */
@@ -101,7 +182,14 @@ void nameViewWindows( const ViewManagerList& lst )
 }
 
 /*!
-  Stores the visual parameters of the viewers
+  Stores the visual parameters of the viewers.
+
+  The state is stored as difference with the state of the previous save point:
+  parameters of views and layout of workstack which are not changed are not
+  copied. States used for Python dump are always stored entirely.
+
+  Versions of the application earlier than state version 2 cannot read
+  differential states: they take the "same as base" markers for the values.
 */
 int SalomeApp_VisualState::storeState()
 {
@@ -122,6 +210,16 @@ int SalomeApp_VisualState::storeState()
   _PTR(AttributeParameter) ap = study->studyDS()->GetCommonParameters( study->getVisualComponentName().toLatin1().constData(), 
 								       savePoint );
   _PTR(IParameters) ip = ClientFactory::getIParameters( ap );
+  ip->setProperty( STATE_VERSION, QString::number( CURRENT_STATE_VERSION ).toStdString() );
+
+  // previous save point is the base of the state, unless chain of differences becomes too long
+  int base = savePoints.size() > 0 ? savePoints[savePoints.size()-1] : 0;
+  _PTR(IParameters) baseIp;
+  if ( base > 0 && !ip->isDumpPython() && stateDepth( study, base, savePoints ) < MAX_BASE_DEPTH )
+  {
+    baseIp = stateParameters( study, base );
+    ip->setProperty( BASE_STATE, QString::number( base ).toStdString() );
+  }
 
   ViewManagerList lst;
   myApp->viewManagers( lst );
@@ -152,18 +250,23 @@ int SalomeApp_VisualState::storeState()
 
     QVector<SUIT_ViewWindow*> views = vm->getViews();
     for(int i = 0; i<view_count; i++) {
+      std::string params = views[i]->getVisualParameters().toStdString();
+      if ( baseIp && resolvedValue( study, baseIp, savePoints, viewerEntry, 2*i+1 ) == params )
+        params = SAME_AS_BASE;
       ip->append( viewerEntry, views[i]->windowTitle().toStdString() );
-      ip->append( viewerEntry, views[i]->getVisualParameters().toStdString() );
+      ip->append( viewerEntry, params );
     }
   }
 
   //Save information about split areas
   if ( myApp->desktop()->inherits( "STD_TabDesktop" ) )
   {
-    QString workstackInfo;
     QtxWorkstack* workstack = ((STD_TabDesktop*)myApp->desktop())->workstack();
     QByteArray geomState = workstack->saveState( 0 );
-    ip->setProperty( "AP_WORKSTACK_INFO", QString( geomState.toHex() ).toStdString() );
+    std::string workstackInfo = QString( geomState.toHex() ).toStdString();
+    if ( baseIp && resolvedValue( study, baseIp, savePoints, "AP_WORKSTACK_INFO", -1 ) == workstackInfo )
+      workstackInfo = SAME_AS_BASE;
+    ip->setProperty( "AP_WORKSTACK_INFO", workstackInfo );
   }
 
   //Save a name of the active module
@@ -200,7 +303,14 @@ int SalomeApp_VisualState::storeState()
 }
 
 /*!
-  Restores the visual parameters of the viewers
+  Restores the visual parameters of the viewers.
+
+  Parameters which are not changed with respect to the base states are
+  taken from them. Existing viewers which can erase their presentations
+  are kept: they are cleared before the modules restore their objects, and
+  their views and the workstack which already are in the stored state are
+  not updated. Other viewers are recreated.
+  State of newer version or with missing base states is not restored.
 */
 void SalomeApp_VisualState::restoreState(int savePoint)
 {
@@ -211,12 +321,36 @@ void SalomeApp_VisualState::restoreState(int savePoint)
   _PTR(AttributeParameter) ap = study->studyDS()->GetCommonParameters( study->getVisualComponentName().toLatin1().constData(),
 								       savePoint );
   _PTR(IParameters) ip = ClientFactory::getIParameters(ap);
+  std::vector<int> savePoints = study->getSavePoints();
+
+  int version = QString( ip->getProperty( STATE_VERSION ).c_str() ).toInt();
+  if ( version > CURRENT_STATE_VERSION )
+  {
+    printf( "\nRestore visual state: state version %d is not supported!\n", version );
+    return;
+  }
+  if ( !isStateComplete( study, ip, savePoints ) )
+  {
+    printf( "\nRestore visual state: base state of save point %d is not found!\n", savePoint );
+    return;
+  }
 
   qApp->installEventFilter( this );
 
-  //Remove all already existent veiwers and their views
-  //myApp->clearViewManagers();
-  myApp->clearKnownViewManagers();
+  // Existing viewers of known types are reused in the order they have been
+  // named on store, other ones are removed below; only viewers which can be
+  // cleared are reused, as the modules restore presentations to empty viewers
+  QStringList knownTypes = myApp->viewManagersTypes();
+  ViewManagerList existingVMs;
+  myApp->viewManagers( existingVMs );
+  QMap<QString, ViewManagerList> freeVMs;
+  for ( ViewManagerList::iterator itVM = existingVMs.begin(); itVM != existingVMs.end(); ++itVM )
+  {
+    if ( *itVM && (*itVM)->getViewsCount() > 0 && knownTypes.contains( (*itVM)->getType() ) &&
+         dynamic_cast<SALOME_View*>( (*itVM)->getViewModel() ) )
+      freeVMs[ (*itVM)->getType() ].append( *itVM );
+  }
+  QList<SUIT_ViewManager*> usedVMs;
 
   //Restore the viewers and view windows
   int nbViewers = ip->nbValues( "AP_VIEWERS_LIST" );
@@ -231,14 +365,24 @@ void SalomeApp_VisualState::restoreState(int savePoint)
     std::vector<std::string> veiewerParams = ip->parseValue(viewerEntry,'_');
     std::string type = veiewerParams[0];
     std::string viewerID = veiewerParams[1];
-    SUIT_ViewManager* vm = myApp->newViewManager( type.c_str() );
+    int nbViews = (ip->nbValues(viewerEntry))/2;
+
+    // viewer having more views than stored ones is recreated
+    SUIT_ViewManager* vm = 0;
+    ViewManagerList& typeVMs = freeVMs[ type.c_str() ];
+    if ( !typeVMs.isEmpty() && typeVMs.first()->getViewsCount() <= nbViews )
+      vm = typeVMs.takeFirst();
+    else
+    {
+      typeVMs.clear();
+      vm = myApp->newViewManager( type.c_str() );
+    }
     if ( !vm )
       continue; //Unknown viewer
+    usedVMs.append( vm );
 
-    int nbViews = (ip->nbValues(viewerEntry))/2;
-
-    //Create nbViews-1 view (-1 because 1 view is created by createViewManager)
-    for ( int i = 1; i< nbViews; i++ )
+    //Create missing views (1 view is created by createViewManager)
+    for ( int i = vm->getViewsCount(); i < nbViews; i++ )
     {
       SUIT_ViewWindow* aView = vm->createViewWindow();
       aView->show();
@@ -266,11 +410,35 @@ void SalomeApp_VisualState::restoreState(int savePoint)
       viewWin->setWindowTitle( ip->getValue( viewerEntry, j ).c_str() );
 
       //      printf ( "VP for viewWin \"%s\": %s\n", viewerEntry.c_str(), ip->getValue(viewerEntry, j+1).c_str() );
-      viewersParameters[ viewWin ] = ip->getValue( viewerEntry, j + 1 ).c_str();
+      viewersParameters[ viewWin ] = resolvedValue( study, ip, savePoints, viewerEntry, j + 1 ).c_str();
       //viewWin->setVisualParameters(ip->getValue(viewerEntry, j+1).c_str());
     }
   }
 
+  //Remove viewers which are not in the state
+  for ( ViewManagerList::iterator itVM = existingVMs.begin(); itVM != existingVMs.end(); ++itVM )
+  {
+    if ( *itVM && knownTypes.contains( (*itVM)->getType() ) && !usedVMs.contains( *itVM ) )
+      myApp->removeViewManager( *itVM );
+  }
+
+  // Presentations of the reused viewers which are not in the state must not stay
+  // displayed: all of them are erased, those in the state are displayed by the modules
+  bool isErased = false;
+  for ( ViewManagerList::iterator itVM = usedVMs.begin(); itVM != usedVMs.end(); ++itVM )
+  {
+    if ( !existingVMs.contains( *itVM ) )
+      continue; // new viewer
+    if ( SALOME_View* aView = dynamic_cast<SALOME_View*>( (*itVM)->getViewModel() ) )
+    {
+      aView->EraseAll( 0, true );
+      aView->Repaint();
+      isErased = true;
+    }
+  }
+  if ( isErased )
+    study->setVisibilityStateForAll( Qtx::HiddenState );
+
   qApp->processEvents( QEventLoop::ExcludeUserInputEvents, 5000 );
 
   // restore modules' visual parameters
@@ -321,7 +489,9 @@ void SalomeApp_VisualState::restoreState(int savePoint)
   if ( myApp->desktop()->inherits( "STD_TabDesktop" ) )
   {
     QtxWorkstack* workstack = ((STD_TabDesktop*)myApp->desktop())->workstack();
-    workstack->restoreState( QByteArray::fromHex( QByteArray( ip->getProperty( "AP_WORKSTACK_INFO" ).c_str() ) ), 0 );
+    QByteArray workstackInfo = QByteArray::fromHex( QByteArray( resolvedValue( study, ip, savePoints, "AP_WORKSTACK_INFO", -1 ).c_str() ) );
+    if ( workstack->saveState( 0 ) != workstackInfo )
+      workstack->restoreState( workstackInfo, 0 );
   }
 
   // restore visual parameters of view windows.  it must be done AFTER restoring workstack.
@@ -329,7 +499,8 @@ void SalomeApp_VisualState::restoreState(int savePoint)
   std::string activeViewName = ip->getProperty("AP_ACTIVE_VIEW");
   QMap<SUIT_ViewWindow*, QString>::Iterator mapIt;
   for ( mapIt = viewersParameters.begin(); mapIt != viewersParameters.end(); ++mapIt ) {
-    mapIt.key()->setVisualParameters( mapIt.value() );
+    if ( mapIt.key()->getVisualParameters() != mapIt.value() )
+      mapIt.key()->setVisualParameters( mapIt.value() );
     if ( activeViewName == mapIt.key()->objectName().toStdString() )
       mapIt.key()->setFocus();
   }
@@ -355,6 +526,54 @@ void SalomeApp_VisualState::restoreState(int savePoint)
   //  }
 }
 
+/*!
+  Makes states of save points based on the given save point self-contained.
+  Should be called before the save point is removed.
+  \param study study
+  \param savePoint save point to be removed
+*/
+void SalomeApp_VisualState::detachStates( SalomeApp_Study* study, int savePoint )
+{
+  if ( !study || savePoint <= 0 )
+    return;
+
+  std::vector<int> savePoints = study->getSavePoints();
+  for ( size_t i = 0; i < savePoints.size(); i++ )
+  {
+    if ( savePoints[i] == savePoint )
+      continue;
+
+    _PTR(AttributeParameter) ap = study->studyDS()->GetCommonParameters( study->getVisualComponentName().toLatin1().constData(),
+                                                                         savePoints[i] );
+    _PTR(IParameters) ip = ClientFactory::getIParameters( ap );
+    if ( baseState( ip, savePoints ) != savePoint )
+      continue;
+
+    // lists of parameters are stored as string arrays of the attribute
+    std::vector<std::string> viewers = ip->getValues( "AP_VIEWERS_LIST" );
+    for ( size_t v = 0; v < viewers.size(); v++ )
+    {
+      std::vector<std::string> values = ip->getValues( viewers[v] );
+      bool changed = false;
+      for ( size_t j = 0; j < values.size(); j++ )
+      {
+        if ( values[j] == SAME_AS_BASE )
+        {
+          values[j] = resolvedValue( study, ip, savePoints, viewers[v], (int)j );
+          changed = true;
+        }
+      }
+      if ( changed )
+        ap->SetStrArray( viewers[v], values );
+    }
+
+    if ( ip->getProperty( "AP_WORKSTACK_INFO" ) == SAME_AS_BASE )
+      ip->setProperty( "AP_WORKSTACK_INFO", resolvedValue( study, ip, savePoints, "AP_WORKSTACK_INFO", -1 ) );
+
+    ip->setProperty( BASE_STATE, "0" );
+  }
+}
+
 /*!
   Custom event filter
 */
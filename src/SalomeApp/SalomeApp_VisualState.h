@@ -32,6 +32,7 @@
 #include <QObject>
 
 class SalomeApp_Application;
+class SalomeApp_Study;
 
 class SALOMEAPPIMPL_EXPORT SalomeApp_VisualState: public QObject
 {
@@ -42,6 +43,8 @@ public:
   virtual int            storeState();
   virtual void           restoreState( int savePoint );
 
+  static void            detachStates( SalomeApp_Study*, int savePoint );
+
 private:
    virtual bool eventFilter( QObject* o, QEvent* e );
 
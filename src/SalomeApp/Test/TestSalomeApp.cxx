@@ -22,6 +22,151 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 
+#include "SalomeApp_NoteBookGraph.h"
+#include "GuiTest.hxx"
+
+#include <QMap>
+#include <QSet>
+#include <QStringList>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  /*!
+    \brief Parameters of a save point of a local study.
+
+    Keeps lists, per-object parameters and properties the same way as
+    the IParameters of the study, and saves them to a string of length
+    prefixed values, as the study attribute is persisted.
+  */
+  class TestParameters
+  {
+  public:
+    void append( const std::string& theList, const std::string& theValue ) { myLists[theList].push_back( theValue ); }
+    int  nbValues( const std::string& theList ) const
+    {
+      std::map< std::string, std::vector<std::string> >::const_iterator it = myLists.find( theList );
+      return it == myLists.end() ? 0 : (int)it->second.size();
+    }
+    std::string getValue( const std::string& theList, int theIndex ) const { return myLists.at( theList ).at( theIndex ); }
+
+    void setParameter( const std::string& theEntry, const std::string& theName, const std::string& theValue )
+    {
+      std::vector<std::string>& aParams = myParameters[theEntry];
+      aParams.push_back( theName );
+      aParams.push_back( theValue );
+    }
+    std::vector<std::string> getEntries() const
+    {
+      std::vector<std::string> anEntries;
+      for ( std::map< std::string, std::vector<std::string> >::const_iterator it = myParameters.begin(); it != myParameters.end(); ++it )
+        anEntries.push_back( it->first );
+      return anEntries;
+    }
+    const std::vector<std::string>& getParameters( const std::string& theEntry ) const { return myParameters.at( theEntry ); }
+
+    void setProperty( const std::string& theName, const std::string& theValue ) { myProperties[theName] = theValue; }
+    std::string getProperty( const std::string& theName ) const
+    {
+      std::map<std::string, std::string>::const_iterator it = myProperties.find( theName );
+      return it == myProperties.end() ? std::string() : it->second;
+    }
+
+    //! Split value by the last separator, as IParameters::parseValue( value, separator, true )
+    static std::vector<std::string> parseValue( const std::string& theValue, char theSeparator )
+    {
+      std::vector<std::string> aParts;
+      std::string::size_type aPos = theValue.rfind( theSeparator );
+      if ( aPos == std::string::npos )
+        aParts.push_back( theValue );
+      else {
+        aParts.push_back( theValue.substr( 0, aPos ) );
+        aParts.push_back( theValue.substr( aPos + 1 ) );
+      }
+      return aParts;
+    }
+
+    std::string save() const
+    {
+      std::ostringstream aStream;
+      saveMap( aStream, myLists );
+      saveMap( aStream, myParameters );
+      aStream << myProperties.size() << ' ';
+      for ( std::map<std::string, std::string>::const_iterator it = myProperties.begin(); it != myProperties.end(); ++it ) {
+        saveString( aStream, it->first );
+        saveString( aStream, it->second );
+      }
+      return aStream.str();
+    }
+
+    void load( const std::string& theData )
+    {
+      std::istringstream aStream( theData );
+      loadMap( aStream, myLists );
+      loadMap( aStream, myParameters );
+      size_t aNb = 0;
+      aStream >> aNb;
+      aStream.get();
+      for ( size_t i = 0; i < aNb; i++ ) {
+        std::string aName = loadString( aStream );
+        myProperties[aName] = loadString( aStream );
+      }
+    }
+
+  private:
+    typedef std::map< std::string, std::vector<std::string> > StringArrays;
+
+    static void saveString( std::ostream& theStream, const std::string& theValue )
+    {
+      theStream << theValue.size() << ' ' << theValue;
+    }
+    static std::string loadString( std::istream& theStream )
+    {
+      size_t aSize = 0;
+      theStream >> aSize;
+      theStream.get();
+      std::string aValue( aSize, ' ' );
+      theStream.read( &aValue[0], aSize );
+      return aValue;
+    }
+    static void saveMap( std::ostream& theStream, const StringArrays& theMap )
+    {
+      theStream << theMap.size() << ' ';
+      for ( StringArrays::const_iterator it = theMap.begin(); it != theMap.end(); ++it ) {
+        saveString( theStream, it->first );
+        theStream << it->second.size() << ' ';
+        for ( size_t i = 0; i < it->second.size(); i++ )
+          saveString( theStream, it->second[i] );
+      }
+    }
+    static void loadMap( std::istream& theStream, StringArrays& theMap )
+    {
+      size_t aNb = 0;
+      theStream >> aNb;
+      theStream.get();
+      for ( size_t i = 0; i < aNb; i++ ) {
+        std::vector<std::string>& aValues = theMap[loadString( theStream )];
+        size_t aNbValues = 0;
+        theStream >> aNbValues;
+        theStream.get();
+        for ( size_t j = 0; j < aNbValues; j++ )
+          aValues.push_back( loadString( theStream ) );
+      }
+    }
+
+    StringArrays                       myLists;
+    StringArrays                       myParameters;
+    std::map<std::string, std::string> myProperties;
+  };
+
+  //! Displayed objects per view: view name -> object entry -> color
+  typedef QMap< QString, QMap<QString, QString> > TestViews;
+}
+
 /*!
   \class SalomeAppTest: test suit
 */
@@ -29,12 +174,18 @@ class SalomeAppTest : public CppUnit::TestFixture
 {
   CPPUNIT_TEST_SUITE( SalomeAppTest );
   CPPUNIT_TEST( testSalomeApp );
+  CPPUNIT_TEST( testNoteBookParameters );
+  CPPUNIT_TEST( testNoteBookGraph );
+  CPPUNIT_TEST( testVisualParameters );
   CPPUNIT_TEST_SUITE_END();
 
 public:
   void setUp();
   void tearDown();
   void testSalomeApp();
+  void testNoteBookParameters();
+  void testNoteBookGraph();
+  void testVisualParameters();
 };
 
 /*!
@@ -57,6 +208,174 @@ void SalomeAppTest::testSalomeApp()
   printf("asdasdasdasdsadasdasdsdasdsad\n");
 }
 
+/*!
+  Check parsing of the variables consumed by objects and used by variables
+*/
+void SalomeAppTest::testNoteBookParameters()
+{
+  QSet<QString> aVariables;
+  aVariables << "L1" << "W" << "e5";
+
+  QStringList aConsumed = SalomeApp_NoteBookGraph::parseParameters( "L1:2.5:W|:L1||X", aVariables );
+  CPPUNIT_ASSERT_EQUAL( 2, (int)aConsumed.count() );
+  CPPUNIT_ASSERT( aConsumed[0] == "L1" && aConsumed[1] == "W" );
+
+  QStringList aUsed = SalomeApp_NoteBookGraph::usedVariables( "L1*2+1e5+sin(W)-W2", aVariables );
+  CPPUNIT_ASSERT_EQUAL( 2, (int)aUsed.count() );
+  CPPUNIT_ASSERT( aUsed[0] == "L1" && aUsed[1] == "W" );
+
+  // removed variable is found only when its old name is given
+  CPPUNIT_ASSERT( SalomeApp_NoteBookGraph::parseParameters( "Removed:2", aVariables ).isEmpty() );
+  aVariables << "Removed";
+  CPPUNIT_ASSERT( SalomeApp_NoteBookGraph::parseParameters( "Removed:2", aVariables ).contains( "Removed" ) );
+}
+
+/*!
+  Check dirty objects computed on a mock study with thousands of parametrized objects
+*/
+void SalomeAppTest::testNoteBookGraph()
+{
+  const int aNbBoxes = 2000;
+  const int aNbFuses = 500;
+
+  // variables L0..L9 and W = L0 * 2
+  SalomeApp_NoteBookGraph aGraph;
+  QSet<QString> aVariables;
+  for ( int i = 0; i < 10; i++ )
+    aVariables.insert( QString( "L%1" ).arg( i ) );
+  aVariables.insert( "W" );
+  aVariables.insert( "Unused" );
+  aGraph.setVariable( "W", SalomeApp_NoteBookGraph::usedVariables( "L0 * 2", aVariables ) );
+  CPPUNIT_ASSERT( !aGraph.hasConsumers() );
+
+  // each box consumes one of the L variables and W, each box has two sub-shapes
+  for ( int i = 0; i < aNbBoxes; i++ ) {
+    QString aBox = QString( "0:1:1:%1" ).arg( i + 1 );
+    QString aParameters = QString( "L%1:W:10" ).arg( i % 10 );
+    aGraph.addObject( aBox, SalomeApp_NoteBookGraph::parseParameters( aParameters, aVariables ) );
+    for ( int j = 1; j <= 2; j++ ) {
+      QString aSubShape = QString( "%1:%2" ).arg( aBox ).arg( j );
+      aGraph.addDependency( aSubShape, aBox );
+      aGraph.addObject( aSubShape, QStringList() );
+    }
+  }
+  // each fuse is built from boxes 4*i+1 and 4*i+2
+  for ( int i = 0; i < aNbFuses; i++ ) {
+    QString aFuse = QString( "0:1:2:%1" ).arg( i + 1 );
+    aGraph.addDependency( aFuse, QString( "0:1:1:%1" ).arg( 4 * i + 1 ) );
+    aGraph.addDependency( aFuse, QString( "0:1:1:%1" ).arg( 4 * i + 2 ) );
+    aGraph.addObject( aFuse, QStringList() );
+  }
+  CPPUNIT_ASSERT_EQUAL( aNbBoxes * 3 + aNbFuses, aGraph.nbObjects() );
+  CPPUNIT_ASSERT( aGraph.hasConsumers() );
+
+  // nothing depends on unused variable
+  CPPUNIT_ASSERT( aGraph.dirtyObjects( QStringList() << "Unused" ).isEmpty() );
+
+  // L3 is consumed by boxes 3, 13, 23, ...: 200 boxes, 400 sub-shapes
+  // and the fuses built from them, i.e. from box 4*i+2 with i % 5 == 3: 100 fuses
+  QStringList aDirty = aGraph.dirtyObjects( QStringList() << "L3" );
+  CPPUNIT_ASSERT_EQUAL( 200 + 400 + 100, (int)aDirty.count() );
+  CPPUNIT_ASSERT( aDirty.first() == "0:1:1:4" );
+  CPPUNIT_ASSERT( aDirty.contains( "0:1:1:4:2" ) );
+  CPPUNIT_ASSERT( aDirty.contains( "0:1:2:4" ) );
+  CPPUNIT_ASSERT( !aDirty.contains( "0:1:1:5" ) );
+
+  // objects are returned in order of their recording: boxes before fuses
+  CPPUNIT_ASSERT( aDirty.indexOf( "0:1:1:1994" ) < aDirty.indexOf( "0:1:2:4" ) );
+
+  // W depends on L0, and all boxes consume W: the whole study is dirty
+  CPPUNIT_ASSERT( aGraph.dependentVariables( QStringList() << "L0" ).contains( "W" ) );
+  CPPUNIT_ASSERT_EQUAL( aGraph.nbObjects(), (int)aGraph.dirtyObjects( QStringList() << "L0" ).count() );
+
+  aGraph.clear();
+  CPPUNIT_ASSERT( aGraph.isEmpty() );
+}
+
+/*!
+  Store and restore visual parameters of thousands of objects displayed in several views
+*/
+void SalomeAppTest::testVisualParameters()
+{
+  const int aNbObjects = 5000;
+  QStringList aViews;
+  aViews << "OCCViewer_0_0" << "OCCViewer_0_1" << "VTKViewer_0_0" << "VTKViewer_1_0" << "ParaView_0_0";
+
+  // object i is displayed in view v unless ( i + v ) is multiple of 3
+  TestViews aDisplayed;
+  for ( int v = 0; v < aViews.count(); v++ ) {
+    QMap<QString, QString>& aView = aDisplayed[aViews[v]];
+    for ( int i = 0; i < aNbObjects; i++ ) {
+      if ( ( i + v ) % 3 != 0 )
+        aView.insert( QString( "0:1:1:%1" ).arg( i + 1 ), QString( "%1:%2:%3" ).arg( i % 256 ).arg( v ).arg( 255 - i % 256 ) );
+    }
+  }
+
+  GuiTest_Timer aTimer( QString( "Visual parameters of %1 objects in %2 views" ).arg( aNbObjects ).arg( aViews.count() ) );
+
+  // store: viewers list, view parameters, then per-object parameters, as modules do
+  TestParameters aStored;
+  aStored.setProperty( "AP_STATE_VERSION", "2" );
+  for ( int v = 0; v < aViews.count(); v++ ) {
+    std::string aViewer = QString( "%1_%2" ).arg( aViews[v].section( '_', 0, 0 ) ).arg( v + 1 ).toStdString();
+    aStored.append( "AP_VIEWERS_LIST", aViewer );
+    aStored.append( aViewer, aViews[v].toStdString() );
+    aStored.append( aViewer, "scale=1.0*centerX=0*centerY=0*projX=0*projY=0*projZ=1" );
+  }
+  for ( TestViews::const_iterator itV = aDisplayed.begin(); itV != aDisplayed.end(); ++itV ) {
+    std::string aView = itV.key().toStdString();
+    for ( QMap<QString, QString>::const_iterator it = itV.value().begin(); it != itV.value().end(); ++it ) {
+      std::string anEntry = it.key().toStdString();
+      aStored.setParameter( anEntry, aView + "_Visibility", "On" );
+      aStored.setParameter( anEntry, aView + "_Color", it.value().toStdString() );
+      aStored.setParameter( anEntry, aView + "_Transparency", "0" );
+    }
+  }
+  aTimer.step( "store" );
+
+  std::string aData = aStored.save();
+  aTimer.step( "save" );
+
+  TestParameters aLoaded;
+  aLoaded.load( aData );
+  aTimer.step( "load" );
+  CPPUNIT_ASSERT( aLoaded.save() == aData );
+  CPPUNIT_ASSERT( aLoaded.getProperty( "AP_STATE_VERSION" ) == "2" );
+  CPPUNIT_ASSERT_EQUAL( aViews.count(), aLoaded.nbValues( "AP_VIEWERS_LIST" ) );
+
+  // restore to the views which are reused from the current state: presentations
+  // of objects which are not in the stored state are erased first
+  TestViews aRestored;
+  for ( int v = 0; v < aViews.count(); v++ ) {
+    QMap<QString, QString>& aView = aRestored[aViews[v]];
+    for ( int i = 0; i < aNbObjects; i++ )
+      aView.insert( QString( "0:1:1:%1" ).arg( i + 1 ), "0:0:0" );
+    aView.clear();
+  }
+  std::vector<std::string> anEntries = aLoaded.getEntries();
+  for ( size_t e = 0; e < anEntries.size(); e++ ) {
+    const std::vector<std::string>& aParams = aLoaded.getParameters( anEntries[e] );
+    QString anEntry = anEntries[e].c_str();
+    for ( size_t p = 0; p + 1 < aParams.size(); p += 2 ) {
+      std::vector<std::string> aName = TestParameters::parseValue( aParams[p], '_' );
+      CPPUNIT_ASSERT_EQUAL( 2, (int)aName.size() );
+      QString aView = aName[0].c_str();
+      if ( aName[1] == "Visibility" && aParams[p+1] == "On" )
+        aRestored[aView].insert( anEntry, aRestored[aView].value( anEntry ) );
+      else if ( aName[1] == "Color" )
+        aRestored[aView][anEntry] = aParams[p+1].c_str();
+    }
+  }
+  aTimer.step( "restore" );
+  aTimer.note( QString( "%1 KB" ).arg( aData.size() / 1024 ) );
+  aTimer.print();
+
+  CPPUNIT_ASSERT( aRestored == aDisplayed );
+  // object 4 is not displayed in the first view: it does not stay there
+  CPPUNIT_ASSERT( !aRestored["OCCViewer_0_0"].contains( "0:1:1:4" ) );
+  CPPUNIT_ASSERT( aRestored["OCCViewer_0_1"].value( "0:1:1:4" ) == "3:1:252" );
+}
+
 // --- Register the fixture into the 'registry'
 
 CPPUNIT_TEST_SUITE_REGISTRATION( SalomeAppTest );
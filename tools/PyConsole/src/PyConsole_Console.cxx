@@ -243,6 +243,28 @@ void PyConsole_Console::setAutoCompletion( const bool on )
     myEditor->setAutoCompletion( on );
 }
 
+/*!
+  \brief Get maximum number of lines kept in the python console.
+  \sa setMaxLines()
+  \return maximum number of lines (0 means unlimited)
+*/
+int PyConsole_Console::maxLines() const
+{
+  return myEditor ? myEditor->maxLines() : 0;
+}
+
+/*!
+  \brief Set maximum number of lines kept in the python console;
+  oldest lines are removed when python output exceeds this limit.
+  \sa maxLines()
+  \param lines maximum number of lines (0 means unlimited)
+*/
+void PyConsole_Console::setMaxLines( const int lines )
+{
+  if ( myEditor )
+    myEditor->setMaxLines( lines );
+}
+
 /*!
   \brief Change the python console's font.
   \param f new font
@@ -75,6 +75,9 @@ public:
   void                setAutoCompletion( bool );
   bool                autoCompletion() const;
 
+  int                 maxLines() const;
+  void                setMaxLines( const int );
+
   void                exec( const QString& );
   void                execAndWait( const QString& );
 
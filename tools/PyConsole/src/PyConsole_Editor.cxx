@@ -108,6 +108,8 @@
 #include <QChar>
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QMutexLocker>
+#include <QTimer>
 #include <QtGlobal>
 
 //VSR: uncomment below macro to support unicode text properly in SALOME
@@ -129,12 +131,14 @@ namespace
 static QString READY_PROMPT = ">>> ";
 static QString DOTS_PROMPT  = "... ";
 
+// minimal interval between two insertions of python output into the editor, in ms
+static const int FLUSH_INTERVAL = 40;
+
 void PyConsole_CallbackStdout( void* data, char* c )
 {
   if(!((PyConsole_Editor*)data)->isSuppressOutput()) {
     PyConsole_Editor* e = (PyConsole_Editor*)data;
-    e->putLog( fromUtf8(c) );
-    QApplication::postEvent( e, new PyConsole_PrintEvent( fromUtf8(c), false ) );
+    e->queueOutput( fromUtf8(c), false );
   }
 }
 
@@ -142,8 +146,7 @@ void PyConsole_CallbackStderr( void* data, char* c )
 {
   if(!((PyConsole_Editor*)data)->isSuppressOutput()) {
     PyConsole_Editor* e = (PyConsole_Editor*)data;
-    e->putLog( fromUtf8(c) );
-    QApplication::postEvent( e, new PyConsole_PrintEvent( fromUtf8(c), true ) );
+    e->queueOutput( fromUtf8(c), true );
   }
 }
 
@@ -189,6 +192,12 @@ void PyConsole_Editor::init()
   myAutoCompletion = false;
   myTabMode = false;
   myComplCursorPos = -1;
+  myIsFlushPosted = false;
+  myMaxLines = 0;
+
+  myFlushTimer = new QTimer( this );
+  myFlushTimer->setSingleShot( true );
+  connect( myFlushTimer, SIGNAL( timeout() ), this, SLOT( flushOutput() ) );
 
   setFont( QFont( "Courier", 11 ) ); // default font
   setUndoRedoEnabled( false );
@@ -328,6 +337,31 @@ bool PyConsole_Editor::autoCompletion() const
   return myAutoCompletion;
 }
 
+/*!
+  \brief Get maximum number of lines kept in the editor.
+  \sa setMaxLines()
+  \return maximum number of lines (0 means unlimited)
+*/
+int PyConsole_Editor::maxLines() const
+{
+  return myMaxLines;
+}
+
+/*!
+  \brief Set maximum number of lines kept in the editor.
+
+  When python output makes the editor exceed this limit, the oldest
+  lines are removed, so that memory used by the console stays bounded.
+
+  \sa maxLines()
+  \param lines maximum number of lines (0 means unlimited)
+*/
+void PyConsole_Editor::setMaxLines( const int lines )
+{
+  myMaxLines = qMax( lines, 0 );
+  trimDocument();
+}
+
 /*!
   \brief Check if trace logging is switched on.
   
@@ -361,6 +395,9 @@ void PyConsole_Editor::addText( const QString& str,
                                 const bool     newBlock,
                                 const bool     isError )
 {
+  // python output printed so far goes first
+  flushOutput();
+
   QTextCursor aCursor = textCursor();
   QTextCharFormat cf;
 
@@ -1183,12 +1220,19 @@ void PyConsole_Editor::keyPressEvent( QKeyEvent* event )
 */
 void PyConsole_Editor::customEvent( QEvent* event )
 {
+  // output printed by a command must be shown before its completion is handled
+  if ( (int) event->type() != PyConsole_PrintEvent::EVENT_ID )
+    flushOutput();
+
   switch( (int) event->type() )
   {
   case PyConsole_PrintEvent::EVENT_ID:
   {
     PyConsole_PrintEvent* pe = (PyConsole_PrintEvent*)event;
-    addText( pe->text(), false, pe->isError() );
+    if ( pe->text().isEmpty() )
+      requestFlush(); // output queued by interpreter callbacks
+    else
+      addText( pe->text(), false, pe->isError() );
     return;
   }
   case PyConsole_CompletionEvent::EVENT_ID:
@@ -1522,6 +1566,104 @@ void PyConsole_Editor::stopLog()
   myLogFile = QString();
 }
 
+/*!
+  \brief Queue python output to be shown in the editor.
+
+  Called from the interpreter's thread: the text is only appended to the
+  pending output, and the editor is notified once until the next flush,
+  whatever the number of writes done by python in the meantime.
+
+  \param text output text
+  \param isError \c true if text is printed to error stream
+*/
+void PyConsole_Editor::queueOutput( const QString& text, const bool isError )
+{
+  bool toPost = false;
+  {
+    QMutexLocker lock( &myOutputMutex );
+    if ( !myOutput.isEmpty() && myOutput.last().second == isError )
+      myOutput.last().first += text;
+    else
+      myOutput.append( qMakePair( text, isError ) );
+    toPost = !myIsFlushPosted;
+    myIsFlushPosted = true;
+  }
+  if ( toPost )
+    QApplication::postEvent( this, new PyConsole_PrintEvent( QString(), isError ) );
+}
+
+/*!
+  \brief Flush pending python output, at most once per FLUSH_INTERVAL ms.
+*/
+void PyConsole_Editor::requestFlush()
+{
+  if ( myFlushTimer->isActive() )
+    return;
+
+  qint64 elapsed = myLastFlush.isValid() ? myLastFlush.elapsed() : FLUSH_INTERVAL;
+  if ( elapsed >= FLUSH_INTERVAL )
+    flushOutput();
+  else
+    myFlushTimer->start( FLUSH_INTERVAL - (int)elapsed );
+}
+
+/*!
+  \brief Put all pending python output to the editor in one go.
+*/
+void PyConsole_Editor::flushOutput()
+{
+  QList< QPair<QString, bool> > output;
+  {
+    QMutexLocker lock( &myOutputMutex );
+    output.swap( myOutput );
+    myIsFlushPosted = false;
+  }
+  myFlushTimer->stop();
+  myLastFlush.start();
+
+  if ( output.isEmpty() )
+    return;
+
+  QTextCursor aCursor = textCursor();
+  QTextCharFormat cf, errorCf;
+  errorCf.setForeground( QBrush( Qt::red ) );
+
+  moveCursor( QTextCursor::End );
+  aCursor.beginEditBlock();
+  for ( int i = 0; i < output.count(); i++ ) {
+    putLog( output[i].first );
+    aCursor.insertText( output[i].first, output[i].second ? errorCf : cf );
+  }
+  aCursor.endEditBlock();
+  trimDocument();
+  moveCursor( QTextCursor::End );
+  ensureCursorVisible();
+}
+
+/*!
+  \brief Remove oldest lines if the editor exceeds the maximum number of lines.
+
+  Some extra lines are tolerated before trimming, so that the document is
+  not trimmed on each flush of python output.
+*/
+void PyConsole_Editor::trimDocument()
+{
+  if ( myMaxLines <= 0 )
+    return;
+
+  int count = document()->blockCount();
+  if ( count <= myMaxLines + myMaxLines / 10 )
+    return;
+
+  int removed = document()->findBlockByNumber( count - myMaxLines ).position();
+  QTextCursor aCursor( document() );
+  aCursor.setPosition( removed, QTextCursor::KeepAnchor );
+  aCursor.removeSelectedText();
+
+  if ( myComplCursorPos >= 0 )
+    myComplCursorPos = qMax( myComplCursorPos - removed, 0 );
+}
+
 /*!
   \brief Put data to the log file
 */
@@ -31,10 +31,14 @@
 
 #include <QTextEdit>
 #include <QQueue>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <QPair>
 
 class PyConsole_Interp;
 class PyInterp_Request;
 class QEventLoop;
+class QTimer;
 
 class PYCONSOLE_EXPORT PyConsole_Editor : public QTextEdit
 {
@@ -65,6 +69,9 @@ public:
   void           setAutoCompletion( bool );
   bool           autoCompletion() const;
 
+  int            maxLines() const;
+  void           setMaxLines( const int );
+
   bool           isLogging() const;
 
   virtual QSize  sizeHint() const;
@@ -83,6 +90,9 @@ public slots:
   void           startLog();
   void           stopLog();
 
+private slots:
+  void           flushOutput();
+
 protected:
   virtual void   dropEvent( QDropEvent* );
   virtual void   mousePressEvent( QMouseEvent* );
@@ -100,6 +110,10 @@ protected:
 private:
   void           init();
 
+  void           queueOutput( const QString&, const bool );
+  void           requestFlush();
+  void           trimDocument();
+
   void           multilinePaste( const QString& );
   void           multiLineProcessNextLine();
 
@@ -136,6 +150,12 @@ private:
   QString                         myComplBeforePoint; //!< string on which the dir() command is executed
   QString                         myComplAfterPoint;  //!< string on which the results of the dir() are matched
   int                             myComplCursorPos;   //!< cursor position when <TAB> is hit
+  QMutex                          myOutputMutex;      //!< guards pending output
+  QList< QPair<QString, bool> >   myOutput;           //!< pending output: text and error flag
+  bool                            myIsFlushPosted;    //!< \c true when flush of pending output is requested
+  QTimer*                         myFlushTimer;       //!< delays flush to keep bounded update rate
+  QElapsedTimer                   myLastFlush;        //!< time of last flush of pending output
+  int                             myMaxLines;         //!< maximum number of lines kept in the editor
 
   friend void PyConsole_CallbackStdout( void*, char* );
   friend void PyConsole_CallbackStderr( void*, char* );
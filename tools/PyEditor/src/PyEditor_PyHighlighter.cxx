@@ -30,6 +30,15 @@
 #define TRIPLESINGLE 1
 #define TRIPLEDOUBLE 2
 
+namespace
+{
+  // characters matched by \w in regular expressions
+  inline bool isWordChar( const QChar& theChar )
+  {
+    return theChar.isLetterOrNumber() || theChar.isMark() || theChar == QLatin1Char( '_' );
+  }
+}
+
 /*!
   \class PyEditor_PyHighlighter
   \brief Python highlighter class defines the syntax highlighting rules.
@@ -83,6 +92,8 @@ void PyEditor_PyHighlighter::highlightBlock( const QString& theText )
 
   setCurrentBlockUserData( aData );
 
+  highlightKeywords( theText );
+
   foreach ( const HighlightingRule& rule, highlightingRules )
   {
     QRegExp expression( rule.pattern );
@@ -132,6 +143,44 @@ void PyEditor_PyHighlighter::highlightBlock( const QString& theText )
   }
 }
 
+/*!
+  \brief Highlight keywords in the text block.
+
+  The text is scanned once: each word is looked up in the keywords table,
+  so the cost does not depend on the number of keywords.
+  \param theText text block
+*/
+void PyEditor_PyHighlighter::highlightKeywords( const QString& theText )
+{
+  if ( keywordFormats.isEmpty() )
+    return;
+
+  const QChar* aData = theText.constData();
+  int aLength = theText.length();
+  int anIndex = 0;
+  while ( anIndex < aLength )
+  {
+    if ( !isWordChar( aData[anIndex] ) )
+    {
+      ++anIndex;
+      continue;
+    }
+
+    int aStart = anIndex;
+    while ( anIndex < aLength && isWordChar( aData[anIndex] ) )
+      ++anIndex;
+
+    int aWordLength = anIndex - aStart;
+    if ( aWordLength < keywordMinLength || aWordLength > keywordMaxLength )
+      continue;
+
+    QHash<QString, QTextCharFormat>::const_iterator it =
+      keywordFormats.constFind( QString::fromRawData( aData + aStart, aWordLength ) );
+    if ( it != keywordFormats.constEnd() )
+      setFormat( aStart, aWordLength, it.value() );
+  }
+}
+
 void PyEditor_PyHighlighter::insertBracketsData( char theLeftSymbol,
                                                  char theRightSymbol,
                                                  TextBlockData* theData,
@@ -195,8 +244,12 @@ void PyEditor_PyHighlighter::onKeywordsChanged()
 void PyEditor_PyHighlighter::updateHighlight()
 {
   highlightingRules.clear();
+  keywordFormats.clear();
+  keywordMinLength = 0;
+  keywordMaxLength = 0;
 
   HighlightingRule aRule;
+  QRegExp aWordExpression( "\\w+" );
 
   QList<PyEditor_Keywords*> dictList;
   dictList << myStdKeywords << myUserKeywords;
@@ -216,10 +269,16 @@ void PyEditor_PyHighlighter::updateHighlight()
 	if ( existing.contains( keyword ) )
 	  continue;
 
-	aRule.pattern = QRegExp( QString( "\\b%1\\b" ).arg( keyword ) );
-	aRule.format = format;
-	aRule.capture = 0;
-	highlightingRules.append( aRule );
+	if ( aWordExpression.exactMatch( keyword ) ) {
+	  // plain words are found by highlightKeywords()
+	  keywordFormats.insert( keyword, format );
+	}
+	else {
+	  aRule.pattern = QRegExp( QString( "\\b%1\\b" ).arg( keyword ) );
+	  aRule.format = format;
+	  aRule.capture = 0;
+	  highlightingRules.append( aRule );
+	}
 	existing.insert( keyword );
       }
     }
@@ -228,10 +287,12 @@ void PyEditor_PyHighlighter::updateHighlight()
   // Reference to the current instance of the class
   referenceClassFormat.setForeground( QColor( 179, 143, 0 ) );
   referenceClassFormat.setFontItalic( true );
-  aRule.pattern = QRegExp( "\\bself\\b" );
-  aRule.format = referenceClassFormat;
-  aRule.capture = 0;
-  highlightingRules.append( aRule );
+  keywordFormats.insert( "self", referenceClassFormat );
+
+  foreach ( const QString& keyword, keywordFormats.keys() ) {
+    keywordMinLength = keywordMinLength ? qMin( keywordMinLength, keyword.length() ) : keyword.length();
+    keywordMaxLength = qMax( keywordMaxLength, keyword.length() );
+  }
 
   // Numbers
   numberFormat.setForeground( Qt::darkMagenta );
@@ -24,6 +24,7 @@
 #define PYEDITOR_PYHIGHLIGHTER_H
 
 #include <QSyntaxHighlighter>
+#include <QHash>
 
 class QTextDocument;
 class PyEditor_Keywords;
@@ -70,6 +71,9 @@ protected:
     int capture;
   };
   QVector<HighlightingRule> highlightingRules;
+  QHash<QString, QTextCharFormat> keywordFormats;
+  int keywordMinLength;
+  int keywordMaxLength;
 
   enum Brackets { RoundBrackets, CurlyBrackets, SquareBrackets };
 
@@ -86,6 +90,7 @@ protected:
   QTextCharFormat quotationFormat;
 
   void highlightBlock( const QString& );
+  void highlightKeywords( const QString& );
   void insertBracketsData( char, char, TextBlockData*, const QString& );
   void insertBracketsData( Brackets, TextBlockData*, const QString& );
 
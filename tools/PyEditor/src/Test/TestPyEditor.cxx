@@ -0,0 +1,184 @@
+// Copyright (C) 2015-2026  OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <GuiTest.hxx>
+
+#include "PyEditor_Keywords.h"
+#include "PyEditor_PyHighlighter.h"
+
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QTextLayout>
+
+namespace
+{
+  // Gets foreground color of the character of the text block, invalid color if it is not formatted
+  QColor foreground( const QTextBlock& theBlock, int thePosition )
+  {
+    QColor aColor;
+    foreach ( const QTextLayout::FormatRange& aRange, theBlock.layout()->formats() ) {
+      if ( thePosition >= aRange.start && thePosition < aRange.start + aRange.length &&
+           aRange.format.hasProperty( QTextFormat::ForegroundBrush ) )
+        aColor = aRange.format.foreground().color();
+    }
+    return aColor;
+  }
+}
+
+/*!
+  \class PyEditorTest: test suit
+*/
+class PyEditorTest : public GuiTest_Fixture
+{
+  CPPUNIT_TEST_SUITE( PyEditorTest );
+  CPPUNIT_TEST( testHighlighter );
+  CPPUNIT_TEST( testUserKeywords );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void testHighlighter();
+  void testUserKeywords();
+};
+
+/*!
+  Check formats of keywords and measure time of highlighting of Python script
+  with fifty thousand lines
+*/
+void PyEditorTest::testHighlighter()
+{
+  const int aNbLines = 50000;
+
+  QStringList aLines;
+  aLines << "x = mykeyword + mykeywords";
+  while ( aLines.count() < aNbLines ) {
+    int anId = aLines.count();
+    aLines << QString( "class Class%1(object):" ).arg( anId )
+           << QString( "    def method%1(self, value=%1.5):" ).arg( anId )
+           << "        # comment with keywords: for while return"
+           << "        if value is not None and len([value]) > 0:"
+           << QString( "            return self.call(\"string %1\", value)" ).arg( anId )
+           << "        return None";
+  }
+
+  QTextDocument aDocument;
+  PyEditor_StandardKeywords aStdKeywords;
+  PyEditor_Keywords aUserKeywords;
+  aUserKeywords.append( "mykeyword", 0, Qt::red );
+
+  GuiTest_Timer aTimer( QString( "PyEditor_PyHighlighter with %1 lines" ).arg( aNbLines ) );
+
+  PyEditor_PyHighlighter* aHighlighter = new PyEditor_PyHighlighter( &aDocument, &aStdKeywords, &aUserKeywords );
+  aDocument.setPlainText( aLines.join( "\n" ) );
+  aTimer.step( "load" );
+
+  aHighlighter->rehighlight();
+  aTimer.step( "rehighlight" );
+
+  // changing of keywords rehighlights the document
+  aUserKeywords.append( "value", 0, Qt::blue );
+  aTimer.step( "keywords change" );
+
+  CPPUNIT_ASSERT( aDocument.blockCount() >= aNbLines );
+
+  // whole words are highlighted only
+  QTextBlock aBlock = aDocument.firstBlock();
+  CPPUNIT_ASSERT( foreground( aBlock, 4 ) == QColor( Qt::red ) );
+  CPPUNIT_ASSERT( foreground( aBlock, 12 ) == QColor( Qt::red ) );
+  CPPUNIT_ASSERT( foreground( aBlock, 16 ) != QColor( Qt::red ) );
+  CPPUNIT_ASSERT( !foreground( aBlock, 0 ).isValid() );
+
+  // new keyword is highlighted, keywords in comments are not
+  aBlock = aBlock.next().next();
+  CPPUNIT_ASSERT( aBlock.text().contains( "self" ) );
+  CPPUNIT_ASSERT( foreground( aBlock, aBlock.text().indexOf( "value" ) ) == QColor( Qt::blue ) );
+  CPPUNIT_ASSERT( foreground( aBlock, aBlock.text().indexOf( "self" ) ).isValid() );
+  aBlock = aBlock.next();
+  CPPUNIT_ASSERT( foreground( aBlock, aBlock.text().indexOf( "for" ) ) ==
+                  foreground( aBlock, aBlock.text().indexOf( "#" ) ) );
+
+  delete aHighlighter;
+
+  aTimer.print();
+}
+
+/*!
+  Check formats of keywords of a large user dictionary and measure time of
+  highlighting of a large document with this dictionary
+*/
+void PyEditorTest::testUserKeywords()
+{
+  const int aNbKeywords = 5000;
+  const int aNbLines = 20000;
+
+  QStringList aKeywords;
+  for ( int i = 0; i < aNbKeywords; i++ )
+    aKeywords << QString( "user_keyword_%1" ).arg( i );
+  const QString aLastKeyword = aKeywords.last();
+
+  // each line refers to a keyword of the dictionary, to a name which is not
+  // a keyword and to the last keyword of the dictionary
+  QStringList aLines;
+  for ( int i = 0; i < aNbLines; i++ )
+    aLines << QString( "x%1 = %2(user_keyword_%3) + %4" )
+      .arg( i ).arg( aKeywords[i % aNbKeywords] ).arg( aNbKeywords + i ).arg( aLastKeyword );
+
+  QTextDocument aDocument;
+  PyEditor_StandardKeywords aStdKeywords;
+  PyEditor_Keywords aUserKeywords;
+
+  GuiTest_Timer aTimer( QString( "PyEditor_PyHighlighter with %1 user keywords, %2 lines" )
+                        .arg( aNbKeywords ).arg( aNbLines ) );
+
+  aUserKeywords.append( aKeywords, 0, Qt::darkGreen );
+  aTimer.step( "dictionary" );
+
+  CPPUNIT_ASSERT_EQUAL( aNbKeywords, aUserKeywords.keywords().count() );
+
+  PyEditor_PyHighlighter* aHighlighter = new PyEditor_PyHighlighter( &aDocument, &aStdKeywords, &aUserKeywords );
+  aDocument.setPlainText( aLines.join( "\n" ) );
+  aTimer.step( "load" );
+
+  aHighlighter->rehighlight();
+  aTimer.step( "rehighlight" );
+
+  CPPUNIT_ASSERT_EQUAL( aNbLines, aDocument.blockCount() );
+
+  // keywords from the beginning and the end of the dictionary are highlighted,
+  // names which only start like keywords are not
+  QTextBlock aBlock = aDocument.lastBlock();
+  QString aText = aBlock.text();
+  CPPUNIT_ASSERT( foreground( aBlock, aText.lastIndexOf( aLastKeyword ) ) == QColor( Qt::darkGreen ) );
+  CPPUNIT_ASSERT( foreground( aBlock, aText.indexOf( "(" ) + 1 ) != QColor( Qt::darkGreen ) );
+  aBlock = aDocument.firstBlock();
+  aText = aBlock.text();
+  CPPUNIT_ASSERT( foreground( aBlock, aText.indexOf( aKeywords.first() ) ) == QColor( Qt::darkGreen ) );
+  CPPUNIT_ASSERT( foreground( aBlock, aText.lastIndexOf( aLastKeyword ) ) == QColor( Qt::darkGreen ) );
+
+  delete aHighlighter;
+
+  aTimer.print();
+}
+
+// --- Register the fixture into the 'registry'
+
+CPPUNIT_TEST_SUITE_REGISTRATION( PyEditorTest );
+
+// --- Generic main() program from Basics/Test (KERNEL module)
+
+#include "BasicMainTest.hxx"